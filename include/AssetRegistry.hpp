@@ -0,0 +1,76 @@
+#ifndef ASSET_REGISTRY_HPP
+#define ASSET_REGISTRY_HPP
+
+#include "TextureCache.hpp"
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <cstddef>
+
+// shared, never null once it came out of the registry. a fallback handle stands in for a file that didn't load
+template <typename T>
+class AssetHandle {
+public:
+    AssetHandle() = default;
+    AssetHandle(std::shared_ptr<T> asset, bool fallback) : m_asset(std::move(asset)), m_fallback(fallback) {}
+
+    T& get() const { return *m_asset; }
+    T& operator*() const { return *m_asset; }
+    T* operator->() const { return m_asset.get(); }
+    const std::shared_ptr<T>& share() const { return m_asset; }
+    explicit operator bool() const { return m_asset != nullptr; }
+    bool isFallback() const { return m_fallback; }
+
+private:
+    std::shared_ptr<T> m_asset;
+    bool m_fallback = false;
+};
+
+using TextureHandle = AssetHandle<sf::Texture>;
+using FontHandle = AssetHandle<sf::Font>;
+using SoundBufferHandle = AssetHandle<sf::SoundBuffer>;
+
+// every asset the game itself loads (menus, player, fonts, sfx) goes through here, each path hits the disk once
+// textures live in the shared TextureCache, so a level using the same file gets the same copy. the registry holds on
+// to what it handed out, those are ui assets needed for the whole run. a failed load is remembered as well: textures
+// fall back to the default texture, fonts and sound buffers to an empty one, and nothing retries every frame
+class AssetRegistry {
+public:
+    struct Stats {
+        std::size_t loadsThisFrame = 0; // disk reads since beginFrame(), 0 once everything is warm
+        std::size_t loadsLastFrame = 0;
+        std::size_t totalLoads = 0;
+        std::size_t failedLoads = 0;
+        std::size_t textures = 0;
+        std::size_t fonts = 0;
+        std::size_t soundBuffers = 0;
+    };
+
+    explicit AssetRegistry(TextureCache& textureCache);
+
+    AssetRegistry(const AssetRegistry&) = delete;
+    AssetRegistry& operator=(const AssetRegistry&) = delete;
+
+    TextureHandle texture(const std::string& path);
+    FontHandle font(const std::string& path);
+    SoundBufferHandle soundBuffer(const std::string& path);
+
+    // top of every frame, rolls the per-frame load counter over
+    void beginFrame();
+    Stats getStats() const;
+
+private:
+    TextureCache& m_textureCache;
+    std::unordered_map<std::string, TextureHandle> m_textures; // by TextureCache::canonicalPath
+    std::unordered_map<std::string, FontHandle> m_fonts;
+    std::unordered_map<std::string, SoundBufferHandle> m_soundBuffers;
+    std::size_t m_loadsThisFrame = 0;
+    std::size_t m_loadsLastFrame = 0;
+    std::size_t m_totalLoads = 0;
+    std::size_t m_failedLoads = 0;
+};
+
+#endif
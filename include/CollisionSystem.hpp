@@ -3,16 +3,20 @@
 
 #include "PhysicsTypes.hpp"
 #include <vector>
+#include <string>
 #include <SFML/System/Vector2.hpp>
 #include "Player.hpp" 
 #include "PlatformBody.hpp" 
+#include "DynamicAABBTree.hpp"
+#include "CollisionWorld.hpp"
+#include "ThreadPool.hpp"
 // i am not burying this comments, since the names are naming itself, i just noticed comments are dirty and fuck the book
 namespace phys {
 
     struct CollisionEvent {
         float time = 1.0f;
         int axis = -1;
-        const PlatformBody* hitPlatform = nullptr;
+        BodyHandle hitPlatform;
     };
 
     struct CollisionResolutionInfo {
@@ -21,26 +25,124 @@ namespace phys {
         bool hitWallLeft = false;
         bool hitWallRight = false;
         sf::Vector2f surfaceVelocity = {0.f, 0.f};
-        const PlatformBody* groundPlatform = nullptr; 
+        BodyHandle groundPlatform;
+        std::size_t narrowphaseTests = 0; // candidates that made it past the type filter this tick
+        bool fromContactCache = false; // resting early-out, no sweeps ran
+    };
+
+    // one trigger body overlapping the queried box, type as it was at query time
+    struct TriggerHit {
+        std::size_t bodyIndex = 0;
+        bodyType type = bodyType::none;
     };
 
     class CollisionSystem {
     public:
+        // the narrowphase only reads the packed arrays of the world, handles in the results point into it
+        static CollisionResolutionInfo resolveCollisions(
+            DynamicBody& dynamicBody,
+            const CollisionWorld& world,
+            float deltaTime
+        );
+
+        // same solver, but only the platforms the broadphase reports near the swept box get tested.
+        // also keeps the body's contact cache, so resting bodies skip the sweeps
         static CollisionResolutionInfo resolveCollisions(
             DynamicBody& dynamicBody,
-            const std::vector<PlatformBody>& platformBodies,
+            const CollisionWorld& world,
+            const DynamicAABBTree& broadphase,
             float deltaTime
         );
 
+        // many bodies against the same platforms, split across the pool. bodies don't see each other,
+        // each one only writes itself, so results are the same as calling the single version in a loop
+        static std::vector<CollisionResolutionInfo> resolveCollisions(
+            std::vector<DynamicBody>& dynamicBodies,
+            const CollisionWorld& world,
+            const DynamicAABBTree& broadphase,
+            float deltaTime,
+            ThreadPool& pool
+        );
+
+        // every trap/goal/portal/interactible strictly overlapping area, in body order, from one broadphase query
+        static void queryTriggers(
+            const sf::FloatRect& area,
+            const CollisionWorld& world,
+            const DynamicAABBTree& broadphase,
+            std::vector<TriggerHit>& outHits
+        );
+
         static bool sweptAABB(
             const DynamicBody& body,
             const sf::Vector2f& displacement,
-            const PlatformBody& platform,
+            const CollisionWorld& world,
+            std::size_t platformIndex,
             float maxTime,
             CollisionEvent& outCollisionEvent
         );
 
+        // sweeps one body against a packed run of platform boxes, 4/8/16 at a time depending on the cpu
+        // outHits[i] is 1 exactly when the scalar sweptAABB would report a hit for box i, returns the hit count
+        static std::size_t sweptAABBBatch(
+            const sf::FloatRect& bodyRect,
+            const sf::Vector2f& displacement,
+            const float* platMinX, const float* platMinY,
+            const float* platMaxX, const float* platMaxY,
+            std::size_t count,
+            std::uint8_t* outHits
+        );
+
+        // world version, fills one event per index (hit or not) the same way sweptAABB does
+        static std::size_t sweptAABBBatch(
+            const DynamicBody& body,
+            const sf::Vector2f& displacement,
+            const CollisionWorld& world,
+            const std::size_t* platformIndices,
+            std::size_t count,
+            CollisionEvent* outEvents
+        );
+
+        // "AVX-512", "AVX2", "SSE2" or "scalar", picked once on first use
+        static const char* sweepKernelName();
+        // every kernel this cpu can run, best first, "scalar" is always there
+        static std::vector<const char*> supportedSweepKernels();
+        // pins a kernel by name for tests and benchmarks, false (and nothing changes) if the cpu can't run it
+        static bool forceSweepKernel(const std::string& name);
+
     private:
+        template <typename CandidateQuery>
+        static CollisionResolutionInfo resolveCollisionsImpl(
+            DynamicBody& dynamicBody,
+            const CollisionWorld& world,
+            float deltaTime,
+            CandidateQuery&& gatherCandidates
+        );
+
+        // resting early-out for the world overload, only taken when the body hasn't moved and
+        // the boxes around it are the same ones, at the same revision, as after the last full solve
+        static bool tryRestingContact(
+            DynamicBody& dynamicBody,
+            const CollisionWorld& world,
+            const DynamicAABBTree& broadphase,
+            float deltaTime,
+            CollisionResolutionInfo& outInfo
+        );
+
+        static void refreshContactCache(
+            DynamicBody& dynamicBody,
+            const CollisionWorld& world,
+            const DynamicAABBTree& broadphase,
+            const CollisionResolutionInfo& info
+        );
+
+        // the actual sweep, platform given as min/max straight out of the world arrays
+        static bool sweepBox(
+            const sf::FloatRect& bodyRect,
+            const sf::Vector2f& displacement,
+            float platMinX, float platMinY, float platMaxX, float platMaxY,
+            CollisionEvent& outCollisionEvent
+        );
+
         static void applyCollisionResponse(
             DynamicBody& dynamicBody,
             const CollisionEvent& event,
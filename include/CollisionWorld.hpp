@@ -0,0 +1,83 @@
+#ifndef COLLISION_WORLD_HPP
+#define COLLISION_WORLD_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <SFML/System/Vector2.hpp>
+#include "PhysicsTypes.hpp"
+#include "PlatformBody.hpp"
+
+namespace phys {
+
+    // packed copy of what the solver actually reads from a platform, one array per field
+    // PlatformBody keeps the gameplay side (id, texture path, portal data...) and stays the source of truth,
+    // call sync() whenever main moves a body or changes its type so both sides agree
+    class CollisionWorld {
+    public:
+        enum SolverFlags : std::uint8_t {
+            Collidable = 1 << 0, // solid for the solver (not goal/trap/portal/none)
+            OneWay = 1 << 1,     // bodyType::platform, only landable from above
+            Conveyor = 1 << 2,   // carries surface velocity into the resolution info
+            Trigger = 1 << 3     // trap/goal/portal/interactible, reported by CollisionSystem::queryTriggers
+        };
+
+        // bytes of hot data the narrowphase reads for one candidate (bounds + flags)
+        static constexpr std::size_t HOT_BYTES_PER_BODY = 4 * sizeof(float) + sizeof(std::uint8_t);
+
+        void rebuild(const std::vector<PlatformBody>& platformBodies);
+        void sync(std::size_t index);
+        void clear();
+        // streamed chunks: the body vector grew to count (new slots start out empty, sync them once they hold a body),
+        // or a slot's body went away. a released slot has no flags and a new generation, so handles to it go stale.
+        // neither touches the epoch, contact caches around the rest of the level stay good
+        void resize(std::size_t count);
+        void release(std::size_t index);
+
+        std::size_t size() const { return m_minX.size(); }
+
+        BodyHandle handleOf(std::size_t index) const { return {static_cast<std::uint32_t>(index), m_generations[index]}; }
+        bool isValid(BodyHandle handle) const { return handle.index < m_generations.size() && m_generations[handle.index] == handle.generation; }
+        // nullptr for null/stale handles, O(1) either way
+        const PlatformBody* get(BodyHandle handle) const { return isValid(handle) ? &(*m_source)[handle.index] : nullptr; }
+
+        // epoch changes on every rebuild, a body's revision every time sync() or release() touches it
+        std::uint32_t getEpoch() const { return m_epoch; }
+        std::uint32_t revision(std::size_t index) const { return m_revisions[index]; }
+        const PlatformBody& body(std::size_t index) const { return (*m_source)[index]; }
+        const std::vector<PlatformBody>& bodies() const { return *m_source; }
+
+        float minX(std::size_t index) const { return m_minX[index]; }
+        float minY(std::size_t index) const { return m_minY[index]; }
+        float maxX(std::size_t index) const { return m_maxX[index]; }
+        float maxY(std::size_t index) const { return m_maxY[index]; }
+        std::uint8_t flags(std::size_t index) const { return m_flags[index]; }
+        bodyType type(std::size_t index) const { return static_cast<bodyType>(m_types[index]); }
+        sf::Vector2f surfaceVelocity(std::size_t index) const { return {m_surfaceVelX[index], m_surfaceVelY[index]}; }
+
+        const float* minXData() const { return m_minX.data(); }
+        const float* minYData() const { return m_minY.data(); }
+        const float* maxXData() const { return m_maxX.data(); }
+        const float* maxYData() const { return m_maxY.data(); }
+
+        static std::uint8_t flagsFor(bodyType type);
+
+    private:
+        const std::vector<PlatformBody>* m_source = nullptr;
+        std::vector<float> m_minX;
+        std::vector<float> m_minY;
+        std::vector<float> m_maxX;
+        std::vector<float> m_maxY;
+        std::vector<std::uint8_t> m_flags;
+        std::vector<std::uint8_t> m_types;
+        std::vector<float> m_surfaceVelX;
+        std::vector<float> m_surfaceVelY;
+        std::vector<std::uint32_t> m_revisions;
+        std::vector<std::uint32_t> m_generations;
+        std::uint32_t m_epoch = 0;
+        std::uint32_t m_lastGeneration = 0; // only grows, so no handle given out earlier can match a newer generation
+    };
+
+}
+
+#endif
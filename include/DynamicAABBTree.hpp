@@ -0,0 +1,81 @@
+#ifndef DYNAMIC_AABB_TREE_HPP
+#define DYNAMIC_AABB_TREE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <SFML/Graphics/Rect.hpp>
+#include "PlatformBody.hpp"
+
+namespace phys {
+
+    // bounding volume tree for platforms that get moved around at runtime (moving, falling, vanishing, interactibles)
+    // every leaf stores a fat box, a body only gets pulled out and reinserted once it leaves that box
+    // so a handful of moving platforms cost a few O(log n) reinserts per tick and never a full rebuild
+    class DynamicAABBTree {
+    public:
+        static constexpr int NullNode = -1;
+
+        explicit DynamicAABBTree(float fatMargin = 8.f);
+
+        void setFatMargin(float margin) { m_fatMargin = margin > 0.f ? margin : 0.f; }
+        float getFatMargin() const { return m_fatMargin; }
+
+        // one proxy per body, proxy ids are kept per body index so callers can just pass the vector index
+        void build(const std::vector<PlatformBody>& platformBodies);
+        void clear();
+
+        // refits the body's leaf, returns true only if it actually had to be reinserted
+        bool updateBody(std::size_t bodyIndex, const sf::FloatRect& aabb);
+        // one body at a time, for streamed chunks coming and going. removing leaves the index free for a later insert
+        void insertBody(std::size_t bodyIndex, const sf::FloatRect& aabb);
+        void removeBody(std::size_t bodyIndex);
+
+        int createProxy(const sf::FloatRect& aabb, std::uint32_t bodyIndex);
+        void destroyProxy(int proxyId);
+        bool moveProxy(int proxyId, const sf::FloatRect& aabb);
+
+        // appends the body index of every fat box touching area, sorted so callers see vector order
+        void query(const sf::FloatRect& area, std::vector<std::size_t>& outIndices) const;
+
+        sf::FloatRect getFatAABB(int proxyId) const;
+        int getHeight() const;
+        std::size_t getProxyCount() const { return m_proxyCount; }
+        std::size_t getReinsertCount() const { return m_reinsertCount; }
+
+    private:
+        struct Box {
+            float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+        };
+
+        struct Node {
+            Box box;
+            int parent = NullNode;
+            int next = NullNode; // free list link
+            int child1 = NullNode;
+            int child2 = NullNode;
+            int height = -1; // -1 = free node, 0 = leaf
+            std::uint32_t bodyIndex = 0;
+            bool isLeaf() const { return child1 == NullNode; }
+        };
+
+        int allocateNode();
+        void freeNode(int nodeId);
+        void insertLeaf(int leaf);
+        void removeLeaf(int leaf);
+        int balance(int nodeId);
+        void refitUpwards(int nodeId);
+        Box fatten(const sf::FloatRect& aabb) const;
+
+        std::vector<Node> m_nodes;
+        std::vector<int> m_bodyProxies;
+        int m_root = NullNode;
+        int m_freeList = NullNode;
+        std::size_t m_proxyCount = 0;
+        std::size_t m_reinsertCount = 0;
+        float m_fatMargin;
+    };
+
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef LEVEL_BINARY_HPP
+#define LEVEL_BINARY_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstddef>
+
+struct LevelData;
+namespace phys { class PlatformBody; }
+
+// read-only view of a whole file. mmap / MapViewOfFile where we can, plain read into a buffer otherwise
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    const std::uint8_t* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    bool isMapped() const { return m_mapped; }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_mapped = false;
+    std::vector<std::uint8_t> m_fallback; // only used when mapping didn't work
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
+
+// a compiled streamed level's file, kept mapped after LevelBinary::load. the platforms stay in it and LevelStreamer reads
+// one chunk's worth (platforms and their TexturesDimensions entries) when that chunk comes into range. const, so any thread
+class LevelChunkFile {
+public:
+    bool open(const std::string& path) { return m_file.open(path); }
+    const std::uint8_t* data() const { return m_file.data(); }
+    std::size_t size() const { return m_file.size(); }
+
+    // chunk indexes LevelData::chunks. false if the file doesn't hold that chunk or it's corrupt
+    bool readChunk(std::size_t chunk, std::vector<phys::PlatformBody>& outPlatforms, std::map<int, sf::IntRect>& outDimensions) const;
+
+private:
+    MappedFile m_file;
+};
+
+// compiled level, what levelc writes and LevelManager maps instead of parsing json
+// layout: header, section table, then every section 16 byte aligned. all little endian, written by the same kind of machine that reads it
+// platforms are SoA (one array per field), the detail tables are flat records, every string lives once in the string table
+// a level big enough to stream is stored chunk by chunk: ChunkTable gives each chunk its run of platforms and dimensions
+class LevelBinary {
+public:
+    static constexpr std::uint32_t Magic = 0x424C564C; // "LVLB"
+    static constexpr std::uint32_t Version = 3; // 2: animation tables, 3: chunk tables
+    static constexpr std::uint32_t NoString = 0xFFFFFFFF;
+
+    // everything the json path hands over: the parsed level plus the texture list it queues for loading.
+    // a partitioned level (LevelData::chunks) is written chunk by chunk
+    static bool write(const std::string& path, const LevelData& levelData, const std::vector<std::string>& texturePaths);
+
+    // fills levelData (not TexturesList) and the texture list. false if the blob is not a level we understand.
+    // a chunked blob fills LevelData::chunks but leaves the platforms in the bytes, load() keeps the file for them
+    static bool read(const std::uint8_t* data, std::size_t size, LevelData& outLevelData, std::vector<std::string>& outTexturePaths);
+    static bool load(const std::string& path, LevelData& outLevelData, std::vector<std::string>& outTexturePaths);
+
+    enum Section : std::uint32_t {
+        StringOffsets = 0, // u32 per string, start in StringBytes
+        StringLengths,     // u32 per string
+        StringBytes,       // char blob, not terminated
+        PlatformId,        // u32
+        PlatformPosX,      // f32
+        PlatformPosY,      // f32
+        PlatformWidth,     // f32
+        PlatformHeight,    // f32
+        PlatformSurfaceVelX, // f32
+        PlatformSurfaceVelY, // f32
+        PlatformPortalId,  // u32
+        PlatformTeleportX, // f32
+        PlatformTeleportY, // f32
+        PlatformTexture,   // u32 string index
+        PlatformType,      // u8
+        PlatformFalling,   // u8
+        MovingTable,       // MovingRecord
+        InteractibleTable, // InteractibleRecord
+        PortalTable,       // PortalRecord
+        DimensionTable,    // DimensionRecord
+        TextureTable,      // u32 string index, load order
+        AnimationTable,    // AnimationRecord
+        AnimationFrameTable, // AnimationFrameRecord, each animation's frames back to back
+        ChunkTable,        // ChunkRecord, empty for a level loaded in one piece
+        ChunkTextureTable, // u32 string index, each chunk's texture paths back to back
+        SectionCount
+    };
+
+    struct SectionEntry {
+        std::uint32_t offset; // from the start of the file
+        std::uint32_t count;  // elements, not bytes
+    };
+
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t fileSize;
+        std::uint32_t sectionCount;
+        std::int32_t levelNumber;
+        std::uint32_t levelName;         // string index
+        std::uint32_t backgroundTexture; // string index, NoString when the level has none
+        std::uint32_t backgroundColor;   // rgba, r in the low byte
+        float playerStartX;
+        float playerStartY;
+        float chunkSize;                 // 0 when there's no ChunkTable
+        std::uint32_t reserved;
+    };
+
+    struct MovingRecord {
+        std::uint32_t id;
+        float startX;
+        float startY;
+        float distance;
+        float cycleDuration;
+        std::int32_t initialDirection;
+        std::uint8_t axis;
+        std::uint8_t pad[3];
+    };
+
+    struct InteractibleRecord {
+        std::uint32_t id;
+        std::uint32_t interactionType; // string index
+        std::uint32_t targetBodyType;  // string index
+        std::uint32_t targetTileColor; // rgba like the header
+        float cooldown;
+        std::uint32_t linkedID;
+        std::uint8_t hasTargetTileColor;
+        std::uint8_t oneTime;
+        std::uint8_t pad[2];
+    };
+
+    struct PortalRecord {
+        std::uint32_t id;
+        std::uint32_t portalID;
+        float offsetX;
+        float offsetY;
+    };
+
+    struct DimensionRecord {
+        std::uint32_t id;
+        std::int32_t left;
+        std::int32_t top;
+        std::int32_t width;
+        std::int32_t height;
+    };
+
+    struct AnimationRecord {
+        std::uint32_t id;
+        std::uint32_t firstFrame; // into AnimationFrameTable
+        std::uint32_t frameCount;
+        std::uint8_t loop;        // LevelData::AnimationLoop
+        std::uint8_t autoplay;
+        std::uint8_t pad[2];
+    };
+
+    struct AnimationFrameRecord {
+        std::int32_t left;
+        std::int32_t top;
+        std::int32_t width;
+        std::int32_t height;
+        float duration;
+    };
+
+    struct ChunkRecord {
+        std::int32_t cellX;
+        std::int32_t cellY;
+        float left;
+        float top;
+        float width;
+        float height;
+        std::uint32_t firstPlatform;  // into the platform arrays
+        std::uint32_t platformCount;
+        std::uint32_t firstDimension; // into DimensionTable
+        std::uint32_t dimensionCount;
+        std::uint32_t firstTexture;   // into ChunkTextureTable
+        std::uint32_t textureCount;
+    };
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef LEVEL_FILE_WATCHER_HPP
+#define LEVEL_FILE_WATCHER_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <filesystem>
+
+// tells which files in one directory were written since the last poll. inotify on linux, so polling is a single
+// non-blocking read. anywhere else it falls back to comparing modification times a couple of times a second
+class LevelFileWatcher {
+public:
+    LevelFileWatcher() = default;
+    ~LevelFileWatcher();
+
+    LevelFileWatcher(const LevelFileWatcher&) = delete;
+    LevelFileWatcher& operator=(const LevelFileWatcher&) = delete;
+
+    bool watch(const std::string& directory);
+    void stop();
+    bool isWatching() const { return !m_directory.empty(); }
+
+    // file names (not paths) closed after writing or moved into the directory, each at most once per call
+    std::vector<std::string> poll();
+
+private:
+    std::string m_directory;
+#ifdef __linux__
+    int m_fd = -1;
+#else
+    std::map<std::string, std::filesystem::file_time_type> m_writeTimes;
+    std::chrono::steady_clock::time_point m_lastScan;
+    void scan(std::vector<std::string>* changed);
+#endif
+};
+
+#endif
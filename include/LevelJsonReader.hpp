@@ -0,0 +1,45 @@
+#ifndef LEVEL_JSON_READER_HPP
+#define LEVEL_JSON_READER_HPP
+
+#include "rapidjson/allocators.h"
+#include "PhysicsTypes.hpp"
+#include <string>
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <cstddef>
+
+struct LevelData;
+
+// levelN.json -> LevelData + texture load list + TexturesDimensions in one streaming (sax) pass, no dom
+// the file is parsed in-situ out of a buffer that stays allocated between loads, the parser's stack lives in a pool
+// that gets reset instead of freed. one read at a time, the prefetch job and the main thread take turns
+class LevelJsonReader {
+public:
+    using BodyTypeLookup = std::function<phys::bodyType(const std::string&)>;
+
+    struct Stats {
+        std::size_t bytes = 0;
+        double readMs = 0.0;  // file -> buffer
+        double parseMs = 0.0; // buffer -> LevelData
+
+        double megabytesPerSecond() const { return parseMs > 0.0 ? (static_cast<double>(bytes) / (1024.0 * 1024.0)) / (parseMs / 1000.0) : 0.0; }
+    };
+
+    explicit LevelJsonReader(BodyTypeLookup bodyTypeLookup);
+
+    LevelJsonReader(const LevelJsonReader&) = delete;
+    LevelJsonReader& operator=(const LevelJsonReader&) = delete;
+
+    // expectedLevelNumber 0 = don't check. TexturesList only gets cleared, the textures come later
+    bool read(const std::string& filename, LevelData& outLevelData, std::vector<std::string>& outTexturePaths, int expectedLevelNumber,
+              Stats* outStats = nullptr);
+
+private:
+    BodyTypeLookup m_bodyTypeLookup;
+    std::mutex m_mutex;
+    std::vector<char> m_buffer; // whole file + '\0', parsed in place
+    rapidjson::MemoryPoolAllocator<> m_arena;
+};
+
+#endif
@@ -1,7 +1,6 @@
 #ifndef LEVEL_MANAGER_HPP
 #define LEVEL_MANAGER_HPP
 
-#include "rapidjson/document.h"
 #include "PlatformBody.hpp"
 #include "SFML/System/Vector2.hpp"
 #include "SFML/System/Clock.hpp"
@@ -15,8 +14,22 @@
 #include <vector>
 #include <map>
 #include "PhysicsTypes.hpp"
+#include "ThreadPool.hpp"
+#include "TextureCache.hpp"
+#include "TextureAtlas.hpp"
+#include "LevelJsonReader.hpp"
+#include "LevelFileWatcher.hpp"
+#include "LevelStreamer.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <cstdint>
 
 namespace phys {}
+class LevelChunkFile;
 
 struct LevelData {
     // level handler of the intial rules
@@ -59,9 +72,45 @@ struct LevelData {
     std::vector<PortalPlatformInfo> portalPlatformDetails;
 
     // Sprites and textures
-    std::map<std::string, sf::Texture> TexturesList; // parameters: filepath : texture
+    std::map<std::string, std::shared_ptr<sf::Texture>> TexturesList; // parameters: filepath : texture (owned by the TextureCache)
     std::map<int, sf::IntRect> TexturesDimensions; // parameters: object id : dimensions
-    bool animated;
+    std::string backgroundTexturePath; // full path, empty when the level has no background image
+    std::shared_ptr<TextureAtlas> atlas; // the level's sprites (not the background) packed together, built when loading finishes
+
+    // sprite animation, a platform's "animation" block. frame rects are in the texture's own space, like TexturesDimensions
+    enum class AnimationLoop : std::uint8_t { Once = 0, Loop, PingPong };
+    struct AnimationInfo {
+        unsigned int id;
+        AnimationLoop loop = AnimationLoop::Once;
+        bool autoplay = true;           // false = waits for SpriteManager::playAnimation (the goal door)
+        std::vector<sf::IntRect> frames;
+        std::vector<float> durations;   // seconds, one per frame
+    };
+    std::vector<AnimationInfo> animationDetails;
+
+    // big levels only, see LevelStreamer. the platforms are split up by world region and move out of platforms and
+    // TexturesDimensions (both end up empty) into their chunk
+    struct Chunk {
+        sf::Vector2i cell;                     // cell * chunkSize is the chunk's top left corner
+        sf::FloatRect bounds;                  // union of its platforms, moving ones over their whole path. can overhang the cell
+        std::vector<std::string> texturePaths; // full paths, each once
+        std::size_t platformCount = 0;
+        // in level file order. a level read from json keeps them here; a compiled one leaves these empty and the
+        // streamer reads them out of chunkFile only while the chunk is resident (LevelStreamer::getChunkPlatforms)
+        std::vector<phys::PlatformBody> platforms;
+        std::map<int, sf::IntRect> dimensions;
+    };
+    float chunkSize = 0.f; // 0 = loaded in one piece
+    std::vector<Chunk> chunks;
+    std::shared_ptr<const LevelChunkFile> chunkFile; // compiled streamed levels only
+};
+
+// what an edit of the running level's json changed, see LevelManager::pollHotReload
+struct LevelReload {
+    // platforms added, removed or reordered, or moving/interactible/portal data touched. the level has to be rebuilt around the player
+    bool structural = false;
+    // indices into LevelData::platforms (so into bodies and tiles too) whose position, size, type or texture changed
+    std::vector<std::size_t> changedPlatforms;
 };
 
 class LevelManager {
@@ -79,6 +128,23 @@ public:
         RESPAWN
     };
 
+    // where one loadLevelNow call spent its time, ms are wall clock per phase
+    struct LoadProfile {
+        bool fromBinary = false;
+        std::size_t fileBytes = 0;
+        double readMs = 0.0;         // json into memory, 0 for the blob (it's mapped, reading is part of parsing)
+        double parseMs = 0.0;        // bytes -> LevelData
+        double chunkMs = 0.0;        // splitting a streamed level into chunks
+        double decodeMs = 0.0;       // every image decoded on the pool
+        double uploadMs = 0.0;       // images -> textures
+        double atlasMs = 0.0;
+        double totalMs = 0.0;
+        std::size_t texturesLoaded = 0;  // paths the load asked for, streamed levels only ask for the start area
+        std::size_t texturesDecoded = 0;
+        std::size_t cacheHits = 0;
+        std::size_t decodedBytes = 0;    // rgba bytes of the decoded images
+    };
+
     LevelManager();
     ~LevelManager();
 
@@ -87,6 +153,19 @@ public:
     void setNextLevelLoadingScreenImage(const std::string& imagePath);
     void setRespawnLoadingScreenImage(const std::string& imagePath);
     void setTransitionProperties(float fadeDuration = 1.0f);
+    // how long one frame may spend turning decoded images into textures while the loading screen is up
+    void setTextureUploadBudget(float milliseconds) { m_textureUploadBudgetMs = std::max(0.f, milliseconds); }
+    // decoded images a prefetched level may hold on to, whatever doesn't fit gets decoded at transition time instead
+    void setPrefetchMemoryBudget(std::size_t bytes) { m_prefetchByteBudget = bytes; }
+    // every level texture and loading screen goes through this, shared across levels
+    TextureCache& getTextureCache() { return m_textureCache; }
+    // chunk streaming for levels past the streamer's platform threshold, the game drives it once loading is done
+    LevelStreamer& getStreamer() { return m_streamer; }
+
+    // watches the level directory, edits to the level being played come back through pollHotReload
+    void setHotReloadEnabled(bool enabled);
+    // once a frame while playing. true when liveLevelData was replaced by the edited file, outReload says what to redo
+    bool pollHotReload(LevelData& liveLevelData, LevelReload& outReload);
 
     bool requestLoadLevel(int levelNumber, LevelData& outLevelData, LoadRequestType type = LoadRequestType::GENERAL);
     bool requestLoadSpecificLevel(int levelNumber, LevelData& outLevelData);
@@ -108,23 +187,65 @@ public:
     // Utility to convert string to bodyType - MADE PUBLIC
     phys::bodyType stringToBodyType(const std::string& typeStr) const;
 
+    // json -> LevelData + texture load list, the same work the transition does. used by levelc
+    bool loadLevelFromJson(const std::string& filename, LevelData& outLevelData, std::vector<std::string>& outTexturePaths);
+    bool compileLevel(const std::string& jsonFilename, const std::string& binaryFilename);
+    // the whole transition load (level data, textures, atlas) as one blocking call, no window or fade. for tools and
+    // benchmarks, the current level number is left alone. uploadTextures = false stops after decoding, for machines without a gpu
+    bool loadLevelNow(int levelNumber, LevelData& outLevelData, LoadProfile* outProfile = nullptr, bool uploadTextures = true);
 
-private:
-    bool performActualLoad(int levelNumber, LevelData& outLevelData);
-    bool loadLevelDataFromFile(const std::string& filename, LevelData& outLevelData);
-    bool loadLevelDataFromJson(const rapidjson::Document& doc, LevelData& outLevelData);
 
-    bool prepareAsynchronousLoad(const rapidjson::Document& d, LevelData& outLevelData);
+private:
+    // compiled levelN.bin next to the json, skipped when missing, stale or from another format version
+    bool tryLoadCompiledLevel(const std::string& binaryFilename, const std::string& jsonFilename, int expectedLevelNumber,
+                              LevelData& outLevelData, std::vector<std::string>& outTexturePaths);
+    // levelN from disk, blob first then json. only reads settings fixed at startup, so the prefetch job runs it on the pool
+    bool readLevel(int levelNumber, LevelData& outLevelData, std::vector<std::string>& outTexturePaths, LoadProfile* outProfile = nullptr);
     void processLoadingTick();
-    rapidjson::Document* m_loadingJsonDoc; //mem handler
+    void startTextureDecodes();
+    void buildLevelAtlas(LevelData& levelData);
     std::vector<std::string> m_texturePathsToLoad; //texture load lsit
-    int m_textureLoadIndex; //list pos
+    std::size_t m_textureLoadIndex; //list pos
+
+    // images decode on the pool, only the upload to the gpu happens on the main thread
+    struct DecodedImage {
+        bool loaded = false;
+        sf::Image image;
+    };
+    std::future<DecodedImage> queueDecode(const std::string& path);
+    static std::future<DecodedImage> readyDecode(DecodedImage&& decoded);
+    // cached texture or the decoded image made into one, stored in levelData.TexturesList (the default texture if both failed)
+    void addLevelTexture(LevelData& levelData, const std::string& path, std::shared_ptr<sf::Texture> texture, const DecodedImage& decoded);
+    TextureCache m_textureCache;
+    ThreadPool m_decodePool;
+    LevelStreamer m_streamer{m_textureCache, m_decodePool};
+    std::vector<std::future<DecodedImage>> m_pendingDecodes; // same order as m_texturePathsToLoad
+    std::vector<std::shared_ptr<sf::Texture>> m_cachedTextures; // cache hits for this load, nullptr where a decode is pending
+    float m_textureUploadBudgetMs;
+    std::chrono::steady_clock::time_point m_loadStartTime;
+    double m_levelParseMs;
+    int m_uploadFrames;
+
+    // next level read and decoded in the background while the current one is played
+    struct PrefetchedLevel {
+        bool ok = false;
+        LevelData data; // TexturesList stays empty, textures can only be made on the main thread
+        std::vector<std::string> texturePaths;
+        std::vector<DecodedImage> images; // same order as texturePaths, not loaded = over the budget or failed
+        std::size_t imageBytes = 0;
+    };
+    void startPrefetch(int levelNumber);
+    void dropPrefetch();
+    bool adoptPrefetch();
+    std::future<std::shared_ptr<PrefetchedLevel>> m_prefetch;
+    std::shared_ptr<std::atomic<bool>> m_prefetchCancel;
+    int m_prefetchLevelNumber;
+    std::size_t m_prefetchByteBudget;
+    bool m_waitingForPrefetch;
 
-    rapidjson::Document* readJsonFile(const std::string& filepath);
-    void freeJsonDocument(rapidjson::Document* doc);
     // phys::bodyType stringToBodyType(const std::string& typeStr); // Moved to public
-    bool parseLevelData(const rapidjson::Document& doc, LevelData& outLevelData);
-    bool parseLevelTextures(const rapidjson::Document& doc, LevelData& outLevelData);
+    LevelJsonReader m_jsonReader; // single pass sax parser, its buffers are reused from one level to the next
+    LevelFileWatcher m_levelWatcher;
 
     int m_currentLevelNumber;
     int m_targetLevelNumber;
@@ -139,7 +260,7 @@ private:
     sf::Clock m_transitionClock;
     float m_fadeDuration;
 
-    sf::Texture m_loadingTexture;
+    std::shared_ptr<sf::Texture> m_loadingTexture;
     std::optional <sf::Sprite> m_loadingSprite;
     bool m_loadingScreenReady;
 
@@ -0,0 +1,55 @@
+#ifndef LEVEL_RUNTIME_HPP
+#define LEVEL_RUNTIME_HPP
+
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include "PlatformBody.hpp"
+
+// lookup tables for the level that's currently running, built once in setupLevelAssets
+// body indices here are indices into bodies (and tiles, and currentLevelData.platforms, they all line up)
+// streamed levels start out empty and get each resident chunk's run of bodies added and removed as it comes and goes
+class LevelRuntime {
+public:
+    static constexpr std::size_t NoIndex = static_cast<std::size_t>(-1);
+
+    void build(const std::vector<phys::PlatformBody>& platformBodies);
+    void clear();
+
+    // bodies [first, first + count) joined or are about to leave. the lists stay sorted, nothing outside the range moves
+    void addBodies(const std::vector<phys::PlatformBody>& platformBodies, std::size_t first, std::size_t count);
+    void removeBodies(const std::vector<phys::PlatformBody>& platformBodies, std::size_t first, std::size_t count);
+
+    // a free run of count body slots, first fit over what removed chunks gave back. past bodyCount when nothing fits,
+    // the caller grows its vectors then
+    std::size_t allocateBodies(std::size_t count, std::size_t bodyCount);
+    void releaseBodies(std::size_t first, std::size_t count);
+
+    // first body with that id, NoIndex if there is none. same answer the old front-to-back scans gave
+    std::size_t indexOf(unsigned int id) const;
+
+    // bodies that do something every tick, grouped by what their level template says they are
+    const std::vector<std::size_t>& getMovingIndices() const { return m_moving; }
+    const std::vector<std::size_t>& getFallingIndices() const { return m_falling; }
+    const std::vector<std::size_t>& getVanishingIndices() const { return m_vanishing; }
+    const std::vector<std::size_t>& getInteractibleIndices() const { return m_interactible; }
+    // falling + vanishing together in body order, that's what the platform state pass walks
+    const std::vector<std::size_t>& getFallingOrVanishingIndices() const { return m_fallingOrVanishing; }
+
+private:
+    std::vector<std::size_t> m_denseIds;                       // id -> index, used while ids stay reasonably small
+    std::unordered_map<unsigned int, std::size_t> m_sparseIds; // whatever doesn't fit the dense table
+    std::vector<std::size_t> m_moving;
+    std::vector<std::size_t> m_falling;
+    std::vector<std::size_t> m_vanishing;
+    std::vector<std::size_t> m_interactible;
+    std::vector<std::size_t> m_fallingOrVanishing;
+
+    struct BodyRange {
+        std::size_t first;
+        std::size_t count;
+    };
+    std::vector<BodyRange> m_freeBodies; // by first, touching runs merged
+};
+
+#endif
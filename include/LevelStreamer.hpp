@@ -0,0 +1,135 @@
+#ifndef LEVEL_STREAMER_HPP
+#define LEVEL_STREAMER_HPP
+
+#include "TextureCache.hpp"
+#include "ThreadPool.hpp"
+#include "PlatformBody.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <future>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+struct LevelData;
+
+// keeps the chunks of a big level (LevelData::chunks) that are near the camera resident and lets the rest go
+// a chunk coming into range gets its missing textures decoded on the pool (and, for a compiled level, its platforms
+// read out of the level file), the upload happens in update() under a frame budget and only then does the chunk count
+// as resident. an evicted compiled chunk drops its platforms again, so memory follows the resident area, not the level. resident chunks pin their textures, evicted ones
+// unpin them so the TextureCache can drop them. the game builds bodies and tiles for resident chunks only, one chunk
+// at a time as getActivated()/getEvicted() report them
+class LevelStreamer {
+public:
+    struct Settings {
+        std::size_t platformThreshold = 20000; // levels with fewer platforms than this load in one piece
+        float chunkSize = 1024.f;              // world units per side of a chunk
+        int loadRadius = 2;                    // chunks around the camera's chunk that get loaded, each way
+        std::size_t maxResident = 36;          // evictions start past this many, never below what the load radius needs
+        float uploadBudgetMs = 2.f;            // per frame, at least one chunk always gets through
+    };
+
+    struct Stats {
+        std::size_t chunks = 0;
+        std::size_t resident = 0;
+        std::size_t loading = 0;
+        std::size_t activations = 0;
+        std::size_t evictions = 0;
+        std::size_t pinnedTextures = 0;
+    };
+
+    LevelStreamer(TextureCache& textureCache, ThreadPool& pool);
+    ~LevelStreamer();
+
+    LevelStreamer(const LevelStreamer&) = delete;
+    LevelStreamer& operator=(const LevelStreamer&) = delete;
+
+    void setSettings(const Settings& settings) { m_settings = settings; }
+    const Settings& getSettings() const { return m_settings; }
+
+    // splits a level big enough to stream into level.chunks, moving its platforms and dimensions over. a compiled
+    // level that came chunked is left as it is. only reads the settings, so the prefetch job can call it
+    bool partition(LevelData& level) const;
+    // keeps the paths the chunks in load range of center need, plus the background and the default texture
+    void filterTexturePaths(const LevelData& level, const sf::Vector2f& center, std::vector<std::string>& paths) const;
+
+    // new level (or the same one rebuilt): forgets every chunk, then makes the ones in range of center resident
+    // right away (getActivated() lists them). textures not loaded yet are read from disk on the spot, so call it
+    // behind a loading screen or a reload
+    void start(const LevelData& level, const sf::Vector2f& center);
+    void stop();
+    bool isStreaming() const { return m_level != nullptr; }
+
+    // once a frame. true when chunks became resident or got evicted, getActivated()/getEvicted() say which
+    bool update(const sf::Vector2f& center);
+
+    // indices into LevelData::chunks, what the last start() or update() changed. a chunk evicted in the same update
+    // it came in is in neither. evicted chunks keep their platforms until the next update, for the caller's teardown
+    const std::vector<std::size_t>& getActivated() const { return m_activated; }
+    const std::vector<std::size_t>& getEvicted() const { return m_evicted; }
+
+    // a resident chunk's platforms and their TexturesDimensions entries, bodies made for it index into these
+    const std::vector<phys::PlatformBody>& getChunkPlatforms(std::size_t chunk) const;
+    const std::map<int, sf::IntRect>& getChunkDimensions(std::size_t chunk) const;
+    // streamed textures, nullptr when path isn't pinned by a resident chunk
+    const sf::Texture* findTexture(const std::string& path) const;
+    Stats getStats() const;
+
+private:
+    enum class ChunkState { Unloaded, Loading, Resident };
+
+    struct DecodedImage {
+        std::string path;
+        bool loaded = false;
+        sf::Image image;
+    };
+
+    // what a pool job hands back for one chunk
+    struct ChunkLoad {
+        std::vector<DecodedImage> images;
+        bool platformsRead = true;
+        std::vector<phys::PlatformBody> platforms;
+        std::map<int, sf::IntRect> dimensions;
+    };
+
+    struct ChunkRuntime {
+        ChunkState state = ChunkState::Unloaded;
+        std::future<ChunkLoad> load;
+        // compiled levels, while resident
+        std::vector<phys::PlatformBody> platforms;
+        std::map<int, sf::IntRect> dimensions;
+    };
+
+    struct PinnedTexture {
+        std::shared_ptr<sf::Texture> texture;
+        std::size_t chunks = 0; // resident chunks using it
+    };
+
+    sf::FloatRect loadArea(const sf::Vector2f& center, int radius) const;
+    bool needsLoad(const std::string& path);
+    void makeResident(std::size_t chunk);
+    void evict(std::size_t chunk);
+
+    TextureCache& m_textureCache;
+    ThreadPool& m_pool;
+    Settings m_settings;
+
+    const LevelData* m_level = nullptr;
+    std::vector<ChunkRuntime> m_chunks; // same order as LevelData::chunks
+    std::unordered_map<std::string, PinnedTexture> m_pinned;
+    std::vector<std::size_t> m_loading;
+    std::vector<std::size_t> m_activated;
+    std::vector<std::size_t> m_evicted;
+    sf::Vector2i m_lastCenterCell{0, 0};
+    bool m_wantedDirty = true;
+    std::size_t m_residentCount = 0;
+    std::size_t m_activations = 0;
+    std::size_t m_evictions = 0;
+};
+
+#endif
@@ -2,6 +2,8 @@
 #ifndef PHYSICS_TYPES_HPP
 #define PHYSICS_TYPES_HPP
 
+#include <cstdint>
+
 namespace phys {
     enum class bodyType {
         none = 0, 
@@ -17,5 +19,19 @@ namespace phys {
         goal = 10, //block that ends the level
         portal = 11, //block that phases the player to a block with the same id of and body type
     };
+
+    // index into the collision world + the generation of that slot when the handle was made
+    // the world bumps generations on every rebuild, so a handle from an old level just stops resolving
+    struct BodyHandle {
+        static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+        std::uint32_t index = InvalidIndex;
+        std::uint32_t generation = 0;
+
+        bool isNull() const { return index == InvalidIndex; }
+        explicit operator bool() const { return !isNull(); }
+        bool operator==(const BodyHandle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const BodyHandle& other) const { return !(*this == other); }
+    };
 }
 #endif
\ No newline at end of file
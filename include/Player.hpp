@@ -3,11 +3,26 @@
 
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp> 
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
 #include "PhysicsTypes.hpp"
 
 namespace phys {
 
     class PlatformBody;
+
+    // what the body was resting on after its last full solve, the solver reuses it while nothing moved
+    // touching holds (world index, world revision) of every broadphase leaf within a pixel of the body
+    struct ContactCache {
+        bool valid = false;
+        std::uint32_t worldEpoch = 0;
+        sf::Vector2f position = {0.f, 0.f};
+        std::size_t groundIndex = 0;
+        std::vector<std::pair<std::size_t, std::uint32_t>> touching;
+    };
+
 	class DynamicBody {
 	public:
 		DynamicBody(
@@ -35,14 +50,19 @@ namespace phys {
         void setOnGround(bool onGround) { m_onGround = onGround; } // Set by main loop after collision
 
         // --- Specific Platform Interaction Logic ---
-        void setGroundPlatform(const PlatformBody* platform);
-        const PlatformBody* getGroundPlatform() const;
+        // handles into the collision world, resolve them with CollisionWorld::get
+        void setGroundPlatform(BodyHandle platform);
+        BodyHandle getGroundPlatform() const;
 
         void setTryingToDrop(bool trying); // Called from input
         bool isTryingToDropFromPlatform() const;
 
-        void setGroundPlatformTemporarilyIgnored(const PlatformBody* platform);
-        const PlatformBody* getGroundPlatformTemporarilyIgnored() const;
+        void setGroundPlatformTemporarilyIgnored(BodyHandle platform);
+        BodyHandle getGroundPlatformTemporarilyIgnored() const;
+
+        ContactCache& getContactCache() { return m_contactCache; }
+        const ContactCache& getContactCache() const { return m_contactCache; }
+        void invalidateContactCache() { m_contactCache.valid = false; m_contactCache.touching.clear(); }
 
 
 	private:
@@ -56,9 +76,11 @@ namespace phys {
         bool m_onGround = false;
 
         // --- State for specific platform interactions ---
-        const PlatformBody* m_groundPlatform = nullptr;
+        BodyHandle m_groundPlatform;
         bool m_isTryingToDrop = false;
-        const PlatformBody* m_tempIgnoredPlatform = nullptr;
+        BodyHandle m_tempIgnoredPlatform;
+
+        ContactCache m_contactCache;
 
         // m_maxSpeed, m_acceleration 
         float m_maxSpeed = 200.f;
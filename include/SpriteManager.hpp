@@ -1,7 +1,15 @@
 #include <string>
 #include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 #include <SFML/Graphics.hpp>
 #include "Tile.hpp"
+#include "TileChangeList.hpp"
+
+struct LevelData;
+namespace phys { class PlatformBody; }
 
 #ifndef SPRITE_MANAGER
 #define SPRITE_MANAGER
@@ -14,31 +22,85 @@ namespace sprites {
         #define IMAGE_DIRECTORY "../assets/images/"
         #define LEVEL_BG_ID "LEVEL_BG"
 
-        public:    
+        public:
             typedef enum {
                 NONE = 0,
                 LEFT = 1,
                 RIGHT = 2
             } PlayerMoveDirection;
-            
-            SpriteManager();
-
-            const sf::Texture& getDefaultTexture() const {return defaultTexture;}
 
-            static std::vector<sf::Texture> LoadLevelTextures(std::vector<std::string>);
+            // textures themselves are loaded through AssetRegistry (game) or the level's TextureCache, not here
 
             static sf::IntRect GetPlayerTextureUponMovement(PlayerMoveDirection direction);
 
-            static bool DoorAnimation(Tile& doorSprite);
+            // --- tile animation ---
+            // clips come from the level (LevelData::animationDetails), one per animated platform. there are no clocks:
+            // updateAnimations gets the frame time and steps every playing animation in one pass over flat arrays,
+            // a tile is only touched when its frame actually changes
+            static constexpr std::size_t NoAnimation = static_cast<std::size_t>(-1);
+
+            struct AnimationStats {
+                std::size_t animations = 0;
+                std::size_t playing = 0;
+                std::size_t bound = 0;        // animations whose platform has a tile right now
+                std::size_t frameChanges = 0; // last updateAnimations
+            };
+
+            // new level, every animation starts over. unknown platform ids are reported and skipped (streamed levels
+            // don't have their platforms at hand, an animation whose platform never shows up just never gets a tile)
+            void loadAnimations(const LevelData& levelData);
+            void clearAnimations();
+            // back to how loadAnimations left them (respawn)
+            void resetAnimations();
+
+            // tiles got rebuilt, tile i was made from bodies[i]. an animation goes to the first tile whose body has its
+            // platform id, tiles coming back get their current frame
+            void bindAnimations(std::vector<Tile>& tiles, const std::vector<phys::PlatformBody>& bodies);
+            // same for just tiles [first, first + count) (a streamed chunk coming in), the other bindings stay
+            void bindAnimations(std::vector<Tile>& tiles, const std::vector<phys::PlatformBody>& bodies, std::size_t first, std::size_t count);
+            // tiles [first, first + count) are going away, their animations keep running without a tile
+            void unbindAnimations(std::size_t first, std::size_t count);
+            // tiles with an animation bound to them, the renderer treats these as dynamic
+            const std::vector<std::size_t>& getAnimatedTiles() const { return m_animatedTiles; }
+
+            // the animation on that tile, NoAnimation if it has none
+            std::size_t animationOfTile(std::size_t tileIndex) const;
+            std::size_t tileOfAnimation(std::size_t animation) const;
+            // from the first frame, also for ones that already finished
+            void playAnimation(std::size_t animation);
+            // a once clip that ran its last frame out. NoAnimation counts as finished, so callers waiting on it don't hang
+            bool isAnimationFinished(std::size_t animation) const;
+
+            // once a frame. new texture rects go into the tiles and into changes for the batch renderer
+            void updateAnimations(sf::Time deltaTime, std::vector<Tile>& tiles, TileChangeList& changes);
+
+            AnimationStats getAnimationStats() const;
+
         private:
-            std::string textureDirectoryRelative = "../assets/sprites/";
-            std::string defaultTexturePath = textureDirectoryRelative + "default.png";
+            static constexpr std::size_t NoFrame = static_cast<std::size_t>(-1);
+
+            struct Clip {
+                std::uint8_t loop = 0; // LevelData::AnimationLoop, PlatformBody.hpp pulls this header in before LevelData exists
+                std::vector<sf::IntRect> frames;
+                std::vector<float> frameEnds; // running sum of the durations, back() is the clip's length
+            };
 
-            sf::Texture defaultTexture;
+            static std::size_t frameAt(const Clip& clip, float time);
 
+            std::vector<Clip> m_clips;                  // per animation
+            // per animation state, struct of arrays so the update pass only walks what it reads
+            std::vector<float> m_time;
+            std::vector<std::size_t> m_frame;           // shown frame, NoFrame = write the frame on the next update
+            std::vector<std::uint8_t> m_playing;
+            std::vector<std::uint8_t> m_finished;
+            std::vector<std::uint8_t> m_autoplay;
+            std::vector<std::size_t> m_tileOf;          // NoAnimation while the platform has no tile (its chunk is out)
+            std::unordered_map<unsigned int, std::size_t> m_animationOfId; // platform id -> animation
+            std::vector<std::size_t> m_animatedTiles;
+            std::size_t m_frameChanges = 0;
     };
 }
 
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,54 @@
+#ifndef TEXTURE_ATLAS_HPP
+#define TEXTURE_ATLAS_HPP
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstddef>
+
+// a level's sprites packed into as few big textures as possible so tiles can be drawn from one texture
+// built on the main thread after the level's textures are up, the copy into the pages happens on the gpu
+class TextureAtlas {
+public:
+    struct Region {
+        std::size_t page = 0;
+        sf::IntRect rect; // where the whole source texture ended up in that page
+    };
+
+    struct Source {
+        std::string key;
+        const sf::Texture* texture = nullptr;
+    };
+
+    struct Stats {
+        std::size_t pages = 0;
+        std::size_t packed = 0;
+        std::size_t skipped = 0;    // bigger than a page, left as their own texture
+        std::size_t usedTexels = 0;
+        std::size_t pageTexels = 0;
+        double packMs = 0.0;         // packing + gpu copy
+
+        float occupancy() const { return pageTexels ? static_cast<float>(usedTexels) / static_cast<float>(pageTexels) : 0.f; }
+    };
+
+    // pageSize gets clamped to what the gpu takes, padding keeps filtering from pulling in the neighbour
+    bool build(const std::vector<Source>& sources, unsigned int pageSize = 4096, unsigned int padding = 2);
+    void clear();
+
+    // nullptr when key wasn't packed
+    const Region* find(const std::string& key) const;
+    const sf::Texture& getPage(std::size_t page) const { return m_pages[page]->getTexture(); }
+    std::size_t getPageCount() const { return m_pages.size(); }
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    std::vector<std::unique_ptr<sf::RenderTexture>> m_pages;
+    std::unordered_map<std::string, Region> m_regions;
+    Stats m_stats;
+};
+
+#endif
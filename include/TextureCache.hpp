@@ -0,0 +1,72 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+#include <SFML/Graphics/Texture.hpp>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+// every texture the game loads, keyed by normalized path, shared between levels
+// whoever holds the shared_ptr keeps the texture alive. entries nobody holds stay cached until the byte budget
+// needs the room, least recently used first. textures only get created on the main thread, lookups are fine from anywhere
+class TextureCache {
+public:
+    struct Stats {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;       // estimated gpu bytes, 4 per texel
+        std::size_t pinnedBytes = 0; // part of bytes somebody outside the cache still holds
+    };
+
+    explicit TextureCache(std::size_t byteBudget = 256u * 1024u * 1024u);
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    void setByteBudget(std::size_t bytes);
+    std::size_t getByteBudget() const { return m_byteBudget; }
+
+    // "../assets/sprites/./a.png" and "../assets/sprites/a.png" are the same entry
+    static std::string canonicalPath(const std::string& path);
+
+    // no stats, no lru bump. for deciding whether a decode is needed at all
+    bool contains(const std::string& path) const;
+
+    // nullptr on a miss
+    std::shared_ptr<sf::Texture> find(const std::string& path);
+    // takes an already made texture, an existing entry for the path wins and is returned instead
+    std::shared_ptr<sf::Texture> insert(const std::string& path, sf::Texture&& texture);
+    // find, or load from disk on a miss. nullptr if the file can't be loaded
+    std::shared_ptr<sf::Texture> acquire(const std::string& path);
+
+    // drops unreferenced entries until the cache fits the budget again
+    void trim();
+    Stats getStats() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<sf::Texture> texture;
+        std::size_t bytes = 0;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    static std::size_t textureBytes(const sf::Texture& texture);
+    void touch(Entry& entry);
+    void trimLocked();
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::list<std::string> m_lru; // front = most recently used
+    std::size_t m_byteBudget;
+    std::size_t m_bytes = 0;
+    std::size_t m_hits = 0;
+    std::size_t m_misses = 0;
+    std::size_t m_evictions = 0;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+// fixed set of worker threads fed from one queue
+// submit() for fire-and-forget / future style jobs, parallelFor() for splitting a range where the caller helps out and waits
+class ThreadPool {
+public:
+    // 0 = one worker per hardware thread minus the calling thread
+    explicit ThreadPool(std::size_t workerCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t getWorkerCount() const { return m_workers.size(); }
+
+    template <typename Fn>
+    auto submit(Fn&& job) -> std::future<typename std::invoke_result<Fn>::type> {
+        using Result = typename std::invoke_result<Fn>::type;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(job));
+        std::future<Result> result = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return result;
+    }
+
+    // calls body(begin, end) over [0, count) in chunks of at least minChunk, blocks until every chunk ran
+    // the calling thread takes chunks too, so this is fine to use with zero workers
+    template <typename Body>
+    void parallelFor(std::size_t count, std::size_t minChunk, Body&& body);
+
+private:
+    void enqueue(std::function<void()> job);
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+};
+
+template <typename Body>
+void ThreadPool::parallelFor(std::size_t count, std::size_t minChunk, Body&& body) {
+    if (count == 0) return;
+    if (minChunk == 0) minChunk = 1;
+
+    // a few chunks per thread so one slow chunk doesn't leave everyone else idle
+    const std::size_t threads = m_workers.size() + 1;
+    std::size_t chunkSize = count / (threads * 4);
+    if (chunkSize < minChunk) chunkSize = minChunk;
+    const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    if (chunkCount == 1 || m_workers.empty()) {
+        body(std::size_t(0), count);
+        return;
+    }
+
+    struct SharedState {
+        std::atomic<std::size_t> nextChunk{0};
+        std::atomic<std::size_t> chunksLeft{0};
+        std::mutex doneMutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<SharedState>();
+    state->chunksLeft = chunkCount;
+
+    auto runChunks = [state, chunkSize, chunkCount, count, &body]() {
+        for (;;) {
+            const std::size_t chunk = state->nextChunk.fetch_add(1);
+            if (chunk >= chunkCount) return;
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end = begin + chunkSize < count ? begin + chunkSize : count;
+            body(begin, end);
+            if (state->chunksLeft.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(state->doneMutex);
+                state->done.notify_all();
+            }
+        }
+    };
+
+    // helpers that start after every chunk is taken just return, body is only touched while chunks are left
+    const std::size_t helpers = chunkCount - 1 < m_workers.size() ? chunkCount - 1 : m_workers.size();
+    for (std::size_t i = 0; i < helpers; ++i) enqueue(runChunks);
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(state->doneMutex);
+    state->done.wait(lock, [&state]() { return state->chunksLeft.load() == 0; });
+}
+
+#endif
@@ -26,9 +26,16 @@ public:
 
     void setFillColor(const sf::Color& color) { m_shape.setFillColor(color); }
     sf::Color getFillColor() const { return m_shape.getFillColor(); }
-    void setTexture(const sf::Texture* texture, bool resetRect = false) { m_shape.setTexture(texture, resetRect); }
-    void setTextureRect(const sf::IntRect rect) {m_shape.setTextureRect(rect);}
+    void setTexture(const sf::Texture* texture, bool resetRect = false) { m_shape.setTexture(texture, resetRect); m_sourceOrigin = {0, 0}; }
+    // texture that holds the tile's image somewhere inside it (an atlas page), rects below stay relative to that image
+    void setTexture(const sf::Texture* texture, const sf::IntRect& sourceRegion);
+    void setTextureRect(const sf::IntRect rect) {m_shape.setTextureRect(sf::IntRect(rect.position + m_sourceOrigin, rect.size));}
     void setSpecialTile(SpecialTile type) {m_specialTileType = type;}
+
+    // what the batch renderer needs to bake the tile into its own quads
+    const sf::Texture* getTexture() const { return m_shape.getTexture(); }
+    sf::IntRect getTextureRect() const { return m_shape.getTextureRect(); }
+    sf::Vector2f getSize() const { return m_shape.getSize(); }
     
     sf::FloatRect getGlobalBounds() const;
     sf::FloatRect getLocalBounds() const;
@@ -39,6 +46,7 @@ private:
     virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
     sf::RectangleShape m_shape;
+    sf::Vector2i m_sourceOrigin;
     bool m_isFalling;
     sf::Time m_fallDelayTimer;
     bool m_hasFallen;
@@ -0,0 +1,165 @@
+#ifndef TILE_BATCH_RENDERER_HPP
+#define TILE_BATCH_RENDERER_HPP
+
+#include "Tile.hpp"
+#include "TileChangeList.hpp"
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// draws the level's tiles as a few vertex arrays instead of one draw call per tile, and only what the view can see
+// static tiles are binned into a uniform grid of cells, each cell bakes one vertex array per texture. the bake only
+// happens again when invalidate() says one of its tiles changed, and cells outside the view are skipped whole.
+// dynamic tiles (moving, falling, vanishing) are binned into the same grid by where they are right now, each cell keeps
+// one array per texture with a quad for every shown dynamic tile in it. only the quads of tiles that applyChanges()
+// lists get rewritten, a tile crossing into another cell moves its quad over, and cells outside the view are skipped
+// on top of that a cell can be rendered once into an offscreen layer (RenderTexture), then a frame composites one quad
+// for it instead of its batches. layers are made when a cell first comes into view and redrawn only after invalidate(),
+// the least recently drawn ones are freed past maxLayers. a cell too big for a texture just keeps drawing its batches
+// tiles sharing a texture are drawn together, so overlapping tiles of different textures can swap draw order
+class TileBatchRenderer : public sf::Drawable {
+public:
+    struct Stats {
+        std::size_t tiles = 0;
+        std::size_t dynamicTiles = 0;
+        std::size_t cells = 0;
+        std::size_t batches = 0;     // static (cell, texture) arrays
+        std::size_t rebakes = 0;     // cells rebuilt since build()
+        // last update()
+        std::size_t drawCalls = 0;
+        std::size_t vertices = 0;
+        std::size_t drawnTiles = 0;
+        std::size_t culledTiles = 0; // visible tiles left out because they're off screen
+        std::size_t layers = 0;        // static cells with a live offscreen layer
+        std::size_t layerRenders = 0;  // layer (re)draws since build()
+        std::size_t layerBytes = 0;    // 4 per texel over the live layers
+        // last applyChanges()
+        std::size_t tileChanges = 0;   // tiles in the change list
+        std::size_t quadWrites = 0;    // dynamic quads rewritten for them
+    };
+
+    explicit TileBatchRenderer(float cellSize = 512.f, std::size_t maxLayers = 24);
+
+    // layers off = every static cell draws its vertex arrays each frame, like before layers existed
+    void setLayersEnabled(bool enabled);
+    // layer texels per world unit, the window's pixels per view unit keeps layers as sharp as drawing the tiles directly
+    void setLayerScale(float scale);
+
+    // regroups everything. the vector is read again on every update(), so build again whenever it gets replaced
+    // (level load, respawn). growing it for a streamed chunk is fine, see addTiles
+    void build(const std::vector<Tile>& tiles, const std::vector<std::size_t>& dynamicTiles);
+    void clear();
+
+    // streamed chunks, without regrouping the rest. addTiles: tiles [first, first + count) were just made (the vector
+    // build() got may have grown for them), static ones go into their cells and only those cells get rebaked,
+    // dynamicTiles (indices inside the range) get quads. removeTiles: the range is about to be overwritten, its quads
+    // and bin entries go and only the cells they were in get rebaked
+    void addTiles(std::size_t first, std::size_t count, const std::vector<std::size_t>& dynamicTiles);
+    void removeTiles(std::size_t first, std::size_t count);
+
+    // a tile's color, position, size or texture changed. a static tile's cell gets rebaked on the next update(), a
+    // static tile that moved into another cell or got another texture changes bins first (both cells get rebaked).
+    // a dynamic tile's quad is rewritten right away
+    void invalidate(std::size_t tileIndex);
+    // invalidate() for everything in the list, once a frame before update(). color only changes to a shown dynamic tile
+    // just repaint its 6 vertices
+    void applyChanges(const TileChangeList& changes);
+
+    // once a frame before drawing. viewBounds is the world rect the view shows, only what touches it gets drawn
+    void update(const sf::FloatRect& viewBounds);
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    static constexpr std::size_t NoCell = static_cast<std::size_t>(-1);
+    static constexpr std::size_t NoSlot = NoCell;
+
+    struct Batch {
+        const sf::Texture* texture = nullptr;
+        std::vector<std::size_t> tiles;
+        sf::VertexArray vertices{sf::PrimitiveType::Triangles};
+    };
+
+    struct DynamicSlot {
+        std::size_t cell = NoCell;  // NoCell while the tile is hidden, hidden tiles have no quad
+        std::size_t batch = 0;      // into the cell's dynamicBatches
+        std::size_t quad = 0;       // vertices [quad * 6, quad * 6 + 6) of the batch, batch.tiles[quad] is the tile
+    };
+
+    struct Cell {
+        sf::FloatRect bounds; // of what got baked, tiles can hang over the cell's edge
+        bool dirty = true;
+        std::size_t quads = 0;
+        std::vector<Batch> batches;
+        // dynamic tiles whose top left is in the cell right now, never baked or layered
+        std::vector<Batch> dynamicBatches;
+        std::size_t dynamicQuads = 0;
+
+        std::unique_ptr<sf::RenderTexture> layer;
+        bool layerStale = true;
+        bool layerTooBig = false; // bounds past the texture size limit, batches it is
+        std::size_t layerUsedFrame = 0;
+        sf::VertexArray layerQuad{sf::PrimitiveType::Triangles}; // bounds in world space, textured with the layer
+    };
+
+    struct DrawItem {
+        const sf::VertexArray* vertices = nullptr;
+        const sf::Texture* texture = nullptr;
+        bool premultiplied = false; // layers hold premultiplied color
+    };
+
+    static std::uint64_t cellKey(int x, int y);
+    // the cell position falls in, made (empty and clean) if the grid doesn't have it yet
+    std::size_t cellIndexAt(const sf::Vector2f& position);
+    // puts a static tile into the cell's batch for its texture
+    void addStaticTile(std::size_t tileIndex, std::size_t cellIndex);
+    void markDirty(std::size_t cellIndex);
+    static bool isVisible(const Tile& tile);
+    // 6 vertices, two triangles
+    static void appendQuad(const Tile& tile, sf::VertexArray& vertices);
+    static void writeQuad(const Tile& tile, sf::VertexArray& vertices, std::size_t firstVertex);
+    void writeSlot(std::size_t tileIndex, std::uint8_t changes);
+    // takes the slot's quad out of its cell, the last quad of the batch fills the gap
+    void removeSlotQuad(DynamicSlot& slot);
+    void bake(Cell& cell);
+    // true when the cell's layer is up to date and can be drawn instead of its batches
+    bool prepareLayer(Cell& cell);
+    void dropLayer(Cell& cell);
+    void trimLayers();
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    float m_cellSize;
+    std::size_t m_maxLayers;
+    bool m_layersEnabled = true;
+    float m_layerScale = 1.f;
+    std::size_t m_frame = 0;
+    const std::vector<Tile>* m_tiles = nullptr;
+    std::vector<Cell> m_cells;
+    std::unordered_map<std::uint64_t, std::size_t> m_cellAt; // grid coords -> m_cells
+    std::vector<std::size_t> m_cellOf;                       // per tile, NoCell for dynamic ones
+    std::vector<std::size_t> m_batchOf;                      // per static tile, into its cell's batches
+    std::vector<std::size_t> m_dirtyCells;                   // baked on the next update, each cell at most once
+    std::size_t m_bakedQuads = 0;                            // over every cell, what the culled count is taken from
+    float m_maxTileExtent = 0.f;                             // widens grid queries so tiles spilling out of their cell still count
+    float m_maxDynamicExtent = 0.f;                          // same for dynamic tiles, against the cell's square instead of baked bounds
+    std::size_t m_dynamicQuads = 0;                          // shown dynamic tiles over every cell
+    std::vector<DynamicSlot> m_slots;
+    std::vector<std::size_t> m_freeSlots;                    // slots removeTiles gave back
+    std::vector<std::size_t> m_slotOf;                       // per tile, NoSlot for static ones
+    std::vector<std::size_t> m_dynamicDrawCells;             // update() scratch, dynamic quads go on top of every static batch
+    std::vector<std::size_t> m_layerCells;                   // cells that hold a layer right now
+    std::vector<DrawItem> m_drawList;
+    Stats m_stats;
+};
+
+#endif
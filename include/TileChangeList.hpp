@@ -0,0 +1,42 @@
+#ifndef TILE_CHANGE_LIST_HPP
+#define TILE_CHANGE_LIST_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// which tiles gameplay changed since the renderer last looked, and what about them
+// the fixed update marks a tile when it actually writes something new to it, TileBatchRenderer::applyChanges turns the
+// list into vertex writes once per frame and the owner clears it. a tile marked twice is still in the list once,
+// its flags just get or'ed together, so the list never grows past the tile count
+class TileChangeList {
+public:
+    enum Change : std::uint8_t {
+        Position = 1 << 0,
+        Color = 1 << 1,
+        TextureRect = 1 << 2,
+        All = Position | Color | TextureRect
+    };
+
+    // tiles got replaced (level load, respawn, streamed chunks), pending changes point at the old ones
+    void reset(std::size_t tileCount);
+    void mark(std::size_t tileIndex, std::uint8_t changes);
+    // after the renderer applied them
+    void clear();
+
+    const std::vector<std::size_t>& getChangedTiles() const { return m_changed; }
+    std::uint8_t changesOf(std::size_t tileIndex) const { return tileIndex < m_flags.size() ? m_flags[tileIndex] : 0; }
+    bool empty() const { return m_changed.empty(); }
+
+    // end of every fixed update, for the hud. a mark counts once per call, however many tiles the list holds
+    void endTick();
+    std::size_t getLastTickChanges() const { return m_lastTickChanges; }
+
+private:
+    std::vector<std::uint8_t> m_flags;  // per tile, 0 = not in m_changed
+    std::vector<std::size_t> m_changed;
+    std::size_t m_tickChanges = 0;
+    std::size_t m_lastTickChanges = 0;
+};
+
+#endif
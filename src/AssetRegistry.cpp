@@ -0,0 +1,75 @@
+#include "AssetRegistry.hpp"
+#include "SpriteManager.hpp"
+#include <iostream>
+
+AssetRegistry::AssetRegistry(TextureCache& textureCache)
+    : m_textureCache(textureCache) {}
+
+TextureHandle AssetRegistry::texture(const std::string& path) {
+    const std::string key = TextureCache::canonicalPath(path);
+    auto it = m_textures.find(key);
+    if (it != m_textures.end()) return it->second;
+
+    // the cache may have it already (a level, the loading screens), then nothing is read from disk
+    if (!m_textureCache.contains(key)) {
+        ++m_loadsThisFrame;
+        ++m_totalLoads;
+    }
+    std::shared_ptr<sf::Texture> texture = m_textureCache.acquire(key);
+    if (texture) return m_textures.emplace(key, TextureHandle(std::move(texture), false)).first->second;
+
+    std::cerr << "AssetRegistry Error: Failed to load texture '" << path << "'. Using default." << std::endl;
+    ++m_failedLoads;
+    const std::string defaultKey = TextureCache::canonicalPath(DEFAULT_TEXTURE_FILEPATH);
+    if (key != defaultKey) texture = this->texture(defaultKey).share();
+    // the default texture itself missing, an empty texture still draws (as untextured)
+    if (!texture) texture = std::make_shared<sf::Texture>();
+    return m_textures.emplace(key, TextureHandle(std::move(texture), true)).first->second;
+}
+
+FontHandle AssetRegistry::font(const std::string& path) {
+    auto it = m_fonts.find(path);
+    if (it != m_fonts.end()) return it->second;
+
+    ++m_loadsThisFrame;
+    ++m_totalLoads;
+    auto font = std::make_shared<sf::Font>();
+    const bool loaded = font->openFromFile(path);
+    if (!loaded) {
+        std::cerr << "AssetRegistry Error: Failed to load font '" << path << "'." << std::endl;
+        ++m_failedLoads;
+    }
+    return m_fonts.emplace(path, FontHandle(std::move(font), !loaded)).first->second;
+}
+
+SoundBufferHandle AssetRegistry::soundBuffer(const std::string& path) {
+    auto it = m_soundBuffers.find(path);
+    if (it != m_soundBuffers.end()) return it->second;
+
+    ++m_loadsThisFrame;
+    ++m_totalLoads;
+    auto buffer = std::make_shared<sf::SoundBuffer>();
+    const bool loaded = buffer->loadFromFile(path);
+    if (!loaded) {
+        std::cerr << "AssetRegistry Error: Failed to load sound '" << path << "'." << std::endl;
+        ++m_failedLoads;
+    }
+    return m_soundBuffers.emplace(path, SoundBufferHandle(std::move(buffer), !loaded)).first->second;
+}
+
+void AssetRegistry::beginFrame() {
+    m_loadsLastFrame = m_loadsThisFrame;
+    m_loadsThisFrame = 0;
+}
+
+AssetRegistry::Stats AssetRegistry::getStats() const {
+    Stats stats;
+    stats.loadsThisFrame = m_loadsThisFrame;
+    stats.loadsLastFrame = m_loadsLastFrame;
+    stats.totalLoads = m_totalLoads;
+    stats.failedLoads = m_failedLoads;
+    stats.textures = m_textures.size();
+    stats.fonts = m_fonts.size();
+    stats.soundBuffers = m_soundBuffers.size();
+    return stats;
+}
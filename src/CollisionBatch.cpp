@@ -0,0 +1,350 @@
+// CollisionBatch.cpp
+// batched swept AABB, same math as CollisionSystem::sweepBox but a whole run of platforms per call
+// the kernels only decide hit / no hit, every hit is finished by the scalar sweep so the event (time, axis) is the exact same one
+#include "CollisionSystem.hpp"
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define PHYS_SWEEP_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+#if defined(PHYS_SWEEP_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define PHYS_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define PHYS_TARGET(isa) // msvc hands out every intrinsic without flags
+#endif
+
+namespace phys {
+
+namespace {
+
+    const float ZERO_DISPLACEMENT = 1e-5f; // same threshold sweepBox uses
+
+    // everything a lane needs that doesn't depend on the platform
+    struct SweepSetup {
+        float bodyMinX, bodyMinY, bodyMaxX, bodyMaxY;
+        float dispX, dispY;
+        bool movingX, movingY;
+    };
+
+    SweepSetup makeSetup(const sf::FloatRect& bodyRect, const sf::Vector2f& displacement) {
+        SweepSetup setup;
+        setup.bodyMinX = bodyRect.position.x;
+        setup.bodyMinY = bodyRect.position.y;
+        setup.bodyMaxX = bodyRect.position.x + bodyRect.size.x;
+        setup.bodyMaxY = bodyRect.position.y + bodyRect.size.y;
+        setup.dispX = displacement.x;
+        setup.dispY = displacement.y;
+        setup.movingX = std::abs(displacement.x) > ZERO_DISPLACEMENT;
+        setup.movingY = std::abs(displacement.y) > ZERO_DISPLACEMENT;
+        return setup;
+    }
+
+    enum class SweepKernel { Scalar, SSE2, AVX2, AVX512 };
+
+#ifdef PHYS_SWEEP_X86
+
+    // a static axis never limits the interval in sweepBox (it ends up -inf/+inf either way),
+    // so lanes just get the infinities broadcast instead of the overlap test
+    // entry = (near plat edge - far body edge) / d, which edges depend only on the sign of d
+    // returns how many boxes were handled, the caller finishes the tail with the scalar sweep
+
+    PHYS_TARGET("sse2")
+    std::size_t sweepHitsSSE2(const SweepSetup& s, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                              std::size_t count, std::uint8_t* outHits) {
+        const __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        const __m128 negInf = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 bodyMinX = _mm_set1_ps(s.bodyMinX), bodyMaxX = _mm_set1_ps(s.bodyMaxX);
+        const __m128 bodyMinY = _mm_set1_ps(s.bodyMinY), bodyMaxY = _mm_set1_ps(s.bodyMaxY);
+        const __m128 dispX = _mm_set1_ps(s.dispX), dispY = _mm_set1_ps(s.dispY);
+
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 entryX = negInf, exitX = inf, entryY = negInf, exitY = inf;
+            if (s.movingX) {
+                const __m128 nearX = _mm_sub_ps(_mm_loadu_ps(minX + i), bodyMaxX);
+                const __m128 farX = _mm_sub_ps(_mm_loadu_ps(maxX + i), bodyMinX);
+                entryX = _mm_div_ps(s.dispX > 0.f ? nearX : farX, dispX);
+                exitX = _mm_div_ps(s.dispX > 0.f ? farX : nearX, dispX);
+            }
+            if (s.movingY) {
+                const __m128 nearY = _mm_sub_ps(_mm_loadu_ps(minY + i), bodyMaxY);
+                const __m128 farY = _mm_sub_ps(_mm_loadu_ps(maxY + i), bodyMinY);
+                entryY = _mm_div_ps(s.dispY > 0.f ? nearY : farY, dispY);
+                exitY = _mm_div_ps(s.dispY > 0.f ? farY : nearY, dispY);
+            }
+            // the scalar swap, entry <= exit afterwards
+            const __m128 loX = _mm_min_ps(entryX, exitX), hiX = _mm_max_ps(entryX, exitX);
+            const __m128 loY = _mm_min_ps(entryY, exitY), hiY = _mm_max_ps(entryY, exitY);
+            const __m128 firstEntry = _mm_max_ps(loX, loY);
+            const __m128 lastExit = _mm_min_ps(hiX, hiY);
+            // hit = !(firstEntry > lastExit || firstEntry >= 1 || lastExit <= 0)
+            const __m128 hit = _mm_and_ps(_mm_cmple_ps(firstEntry, lastExit),
+                               _mm_and_ps(_mm_cmplt_ps(firstEntry, one), _mm_cmpgt_ps(lastExit, zero)));
+            const int mask = _mm_movemask_ps(hit);
+            for (int lane = 0; lane < 4; ++lane) outHits[i + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+        }
+        return i;
+    }
+
+    PHYS_TARGET("avx2")
+    std::size_t sweepHitsAVX2(const SweepSetup& s, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                              std::size_t count, std::uint8_t* outHits) {
+        const __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+        const __m256 negInf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 bodyMinX = _mm256_set1_ps(s.bodyMinX), bodyMaxX = _mm256_set1_ps(s.bodyMaxX);
+        const __m256 bodyMinY = _mm256_set1_ps(s.bodyMinY), bodyMaxY = _mm256_set1_ps(s.bodyMaxY);
+        const __m256 dispX = _mm256_set1_ps(s.dispX), dispY = _mm256_set1_ps(s.dispY);
+
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 entryX = negInf, exitX = inf, entryY = negInf, exitY = inf;
+            if (s.movingX) {
+                const __m256 nearX = _mm256_sub_ps(_mm256_loadu_ps(minX + i), bodyMaxX);
+                const __m256 farX = _mm256_sub_ps(_mm256_loadu_ps(maxX + i), bodyMinX);
+                entryX = _mm256_div_ps(s.dispX > 0.f ? nearX : farX, dispX);
+                exitX = _mm256_div_ps(s.dispX > 0.f ? farX : nearX, dispX);
+            }
+            if (s.movingY) {
+                const __m256 nearY = _mm256_sub_ps(_mm256_loadu_ps(minY + i), bodyMaxY);
+                const __m256 farY = _mm256_sub_ps(_mm256_loadu_ps(maxY + i), bodyMinY);
+                entryY = _mm256_div_ps(s.dispY > 0.f ? nearY : farY, dispY);
+                exitY = _mm256_div_ps(s.dispY > 0.f ? farY : nearY, dispY);
+            }
+            const __m256 loX = _mm256_min_ps(entryX, exitX), hiX = _mm256_max_ps(entryX, exitX);
+            const __m256 loY = _mm256_min_ps(entryY, exitY), hiY = _mm256_max_ps(entryY, exitY);
+            const __m256 firstEntry = _mm256_max_ps(loX, loY);
+            const __m256 lastExit = _mm256_min_ps(hiX, hiY);
+            const __m256 hit = _mm256_and_ps(_mm256_cmp_ps(firstEntry, lastExit, _CMP_LE_OQ),
+                               _mm256_and_ps(_mm256_cmp_ps(firstEntry, one, _CMP_LT_OQ), _mm256_cmp_ps(lastExit, zero, _CMP_GT_OQ)));
+            const int mask = _mm256_movemask_ps(hit);
+            for (int lane = 0; lane < 8; ++lane) outHits[i + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+        }
+        return i;
+    }
+
+    PHYS_TARGET("avx512f")
+    std::size_t sweepHitsAVX512(const SweepSetup& s, const float* minX, const float* minY, const float* maxX, const float* maxY,
+                                std::size_t count, std::uint8_t* outHits) {
+        const __m512 inf = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+        const __m512 negInf = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 zero = _mm512_setzero_ps();
+        const __m512 bodyMinX = _mm512_set1_ps(s.bodyMinX), bodyMaxX = _mm512_set1_ps(s.bodyMaxX);
+        const __m512 bodyMinY = _mm512_set1_ps(s.bodyMinY), bodyMaxY = _mm512_set1_ps(s.bodyMaxY);
+        const __m512 dispX = _mm512_set1_ps(s.dispX), dispY = _mm512_set1_ps(s.dispY);
+
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m512 entryX = negInf, exitX = inf, entryY = negInf, exitY = inf;
+            if (s.movingX) {
+                const __m512 nearX = _mm512_sub_ps(_mm512_loadu_ps(minX + i), bodyMaxX);
+                const __m512 farX = _mm512_sub_ps(_mm512_loadu_ps(maxX + i), bodyMinX);
+                entryX = _mm512_div_ps(s.dispX > 0.f ? nearX : farX, dispX);
+                exitX = _mm512_div_ps(s.dispX > 0.f ? farX : nearX, dispX);
+            }
+            if (s.movingY) {
+                const __m512 nearY = _mm512_sub_ps(_mm512_loadu_ps(minY + i), bodyMaxY);
+                const __m512 farY = _mm512_sub_ps(_mm512_loadu_ps(maxY + i), bodyMinY);
+                entryY = _mm512_div_ps(s.dispY > 0.f ? nearY : farY, dispY);
+                exitY = _mm512_div_ps(s.dispY > 0.f ? farY : nearY, dispY);
+            }
+            const __m512 loX = _mm512_min_ps(entryX, exitX), hiX = _mm512_max_ps(entryX, exitX);
+            const __m512 loY = _mm512_min_ps(entryY, exitY), hiY = _mm512_max_ps(entryY, exitY);
+            const __m512 firstEntry = _mm512_max_ps(loX, loY);
+            const __m512 lastExit = _mm512_min_ps(hiX, hiY);
+            const __mmask16 mask = _mm512_cmp_ps_mask(firstEntry, lastExit, _CMP_LE_OQ)
+                                 & _mm512_cmp_ps_mask(firstEntry, one, _CMP_LT_OQ)
+                                 & _mm512_cmp_ps_mask(lastExit, zero, _CMP_GT_OQ);
+            for (int lane = 0; lane < 16; ++lane) outHits[i + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+        }
+        return i;
+    }
+
+    struct CpuFeatures {
+        bool sse2 = false;
+        bool avx2 = false;
+        bool avx512 = false;
+    };
+
+    CpuFeatures detectFeatures() {
+        CpuFeatures features;
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4] = {0, 0, 0, 0};
+        __cpuid(info, 0);
+        const int maxLeaf = info[0];
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        features.sse2 = (info[3] & (1 << 26)) != 0;
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        if (maxLeaf >= 7) {
+            __cpuidex(info, 7, 0);
+            features.avx2 = avx && (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0;
+            features.avx512 = (xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)) != 0;
+        }
+    #else
+        __builtin_cpu_init();
+        features.sse2 = __builtin_cpu_supports("sse2");
+        features.avx2 = __builtin_cpu_supports("avx2");
+        features.avx512 = __builtin_cpu_supports("avx512f");
+    #endif
+        return features;
+    }
+
+    bool kernelSupported(SweepKernel kernel) {
+        static const CpuFeatures features = detectFeatures();
+        switch (kernel) {
+            case SweepKernel::AVX512: return features.avx512;
+            case SweepKernel::AVX2: return features.avx2;
+            case SweepKernel::SSE2: return features.sse2;
+            default: return true;
+        }
+    }
+
+#else
+
+    bool kernelSupported(SweepKernel kernel) { return kernel == SweepKernel::Scalar; } // arm etc, the scalar sweep is all we have
+
+#endif
+
+    const SweepKernel KERNELS_BEST_FIRST[] = {SweepKernel::AVX512, SweepKernel::AVX2, SweepKernel::SSE2, SweepKernel::Scalar};
+
+    SweepKernel detectKernel() {
+        for (SweepKernel kernel : KERNELS_BEST_FIRST) {
+            if (kernelSupported(kernel)) return kernel;
+        }
+        return SweepKernel::Scalar;
+    }
+
+    // only forceSweepKernel writes it, and that's for tests/benchmarks before any sweep runs
+    SweepKernel& activeKernel() {
+        static SweepKernel kernel = detectKernel();
+        return kernel;
+    }
+
+    const char* kernelName(SweepKernel kernel) {
+        switch (kernel) {
+            case SweepKernel::AVX512: return "AVX-512";
+            case SweepKernel::AVX2: return "AVX2";
+            case SweepKernel::SSE2: return "SSE2";
+            default: return "scalar";
+        }
+    }
+
+}
+
+const char* CollisionSystem::sweepKernelName() {
+    return kernelName(activeKernel());
+}
+
+std::vector<const char*> CollisionSystem::supportedSweepKernels() {
+    std::vector<const char*> names;
+    for (SweepKernel kernel : KERNELS_BEST_FIRST) {
+        if (kernelSupported(kernel)) names.push_back(kernelName(kernel));
+    }
+    return names;
+}
+
+bool CollisionSystem::forceSweepKernel(const std::string& name) {
+    for (SweepKernel kernel : KERNELS_BEST_FIRST) {
+        if (name != kernelName(kernel)) continue;
+        if (!kernelSupported(kernel)) return false;
+        activeKernel() = kernel;
+        return true;
+    }
+    return false;
+}
+
+std::size_t CollisionSystem::sweptAABBBatch(
+    const sf::FloatRect& bodyRect,
+    const sf::Vector2f& displacement,
+    const float* platMinX, const float* platMinY,
+    const float* platMaxX, const float* platMaxY,
+    std::size_t count,
+    std::uint8_t* outHits)
+{
+    const SweepSetup setup = makeSetup(bodyRect, displacement);
+    std::size_t done = 0;
+
+    // zero displacement is the static overlap branch of sweepBox, rare enough to leave scalar
+    if (setup.movingX || setup.movingY) {
+#ifdef PHYS_SWEEP_X86
+        switch (activeKernel()) {
+            case SweepKernel::AVX512:
+                done = sweepHitsAVX512(setup, platMinX, platMinY, platMaxX, platMaxY, count, outHits);
+                break;
+            case SweepKernel::AVX2:
+                done = sweepHitsAVX2(setup, platMinX, platMinY, platMaxX, platMaxY, count, outHits);
+                break;
+            case SweepKernel::SSE2:
+                done = sweepHitsSSE2(setup, platMinX, platMinY, platMaxX, platMaxY, count, outHits);
+                break;
+            default:
+                break;
+        }
+#endif
+    }
+
+    CollisionEvent scratch;
+    for (std::size_t i = done; i < count; ++i) {
+        outHits[i] = sweepBox(bodyRect, displacement, platMinX[i], platMinY[i], platMaxX[i], platMaxY[i], scratch) ? 1 : 0;
+    }
+
+    std::size_t hitCount = 0;
+    for (std::size_t i = 0; i < count; ++i) hitCount += outHits[i];
+    return hitCount;
+}
+
+std::size_t CollisionSystem::sweptAABBBatch(
+    const DynamicBody& body,
+    const sf::Vector2f& displacement,
+    const CollisionWorld& world,
+    const std::size_t* platformIndices,
+    std::size_t count,
+    CollisionEvent* outEvents)
+{
+    // the world arrays are indexed by body, the kernels want a contiguous run so gather first
+    thread_local std::vector<float> minX, minY, maxX, maxY;
+    thread_local std::vector<std::uint8_t> hits;
+    minX.resize(count);
+    minY.resize(count);
+    maxX.resize(count);
+    maxY.resize(count);
+    hits.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t index = platformIndices[i];
+        minX[i] = world.minX(index);
+        minY[i] = world.minY(index);
+        maxX[i] = world.maxX(index);
+        maxY[i] = world.maxY(index);
+    }
+
+    const sf::FloatRect bodyRect = body.getAABB();
+    const std::size_t hitCount = sweptAABBBatch(bodyRect, displacement, minX.data(), minY.data(), maxX.data(), maxY.data(), count, hits.data());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        CollisionEvent& event = outEvents[i];
+        if (hits[i]) {
+            sweepBox(bodyRect, displacement, minX[i], minY[i], maxX[i], maxY[i], event);
+            event.hitPlatform = world.handleOf(platformIndices[i]);
+        } else {
+            event = CollisionEvent{};
+            event.time = 2.0f; // what a miss looks like coming out of sweptAABB
+        }
+    }
+    return hitCount;
+}
+
+} // namespace phys
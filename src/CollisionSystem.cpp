@@ -17,14 +17,192 @@
 
 namespace phys {
 
+namespace {
+
+    // narrowphase survivors laid out for sweptAABBBatch
+    struct PackedCandidates {
+        std::vector<std::size_t> indices;
+        std::vector<float> minX, minY, maxX, maxY;
+        std::vector<std::uint8_t> hits;
+
+        std::size_t size() const { return indices.size(); }
+        void clear() {
+            indices.clear();
+            minX.clear(); minY.clear(); maxX.clear(); maxY.clear();
+        }
+        void push(std::size_t index, float x0, float y0, float x1, float y1) {
+            indices.push_back(index);
+            minX.push_back(x0); minY.push_back(y0); maxX.push_back(x1); maxY.push_back(y1);
+        }
+    };
+
+}
+
+CollisionResolutionInfo CollisionSystem::resolveCollisions(
+    DynamicBody& dynamicBody,
+    const CollisionWorld& world,
+    float deltaTime)
+{
+    // no broadphase, every platform is a candidate
+    return resolveCollisionsImpl(dynamicBody, world, deltaTime,
+        [&world](const sf::FloatRect&, std::vector<std::size_t>& out) {
+            for (std::size_t i = 0; i < world.size(); ++i) out.push_back(i);
+        });
+}
+
 CollisionResolutionInfo CollisionSystem::resolveCollisions(
     DynamicBody& dynamicBody,
-    const std::vector<PlatformBody>& platformBodies,
+    const CollisionWorld& world,
+    const DynamicAABBTree& broadphase,
     float deltaTime)
+{
+    CollisionResolutionInfo resolutionInfo;
+    if (tryRestingContact(dynamicBody, world, broadphase, deltaTime, resolutionInfo)) {
+        return resolutionInfo;
+    }
+
+    resolutionInfo = resolveCollisionsImpl(dynamicBody, world, deltaTime,
+        [&broadphase](const sf::FloatRect& sweptBounds, std::vector<std::size_t>& out) {
+            broadphase.query(sweptBounds, out);
+        });
+    refreshContactCache(dynamicBody, world, broadphase, resolutionInfo);
+    return resolutionInfo;
+}
+
+namespace {
+
+    const float CONTACT_SKIN = 1.0f; // grow the body a bit so the ground it stands on is always in the cached set
+
+    // grounds with no per-tick behaviour, conveyors/moving/falling/springs/vanishing always get the full solve
+    bool isRestingGround(bodyType type) {
+        return type == bodyType::solid || type == bodyType::platform || type == bodyType::interactible;
+    }
+
+    sf::FloatRect contactSkin(const DynamicBody& body) {
+        sf::FloatRect skin = body.getAABB();
+        skin.position -= {CONTACT_SKIN, CONTACT_SKIN};
+        skin.size += {2.f * CONTACT_SKIN, 2.f * CONTACT_SKIN};
+        return skin;
+    }
+
+}
+
+bool CollisionSystem::tryRestingContact(
+    DynamicBody& dynamicBody,
+    const CollisionWorld& world,
+    const DynamicAABBTree& broadphase,
+    float deltaTime,
+    CollisionResolutionInfo& outInfo)
+{
+    ContactCache& cache = dynamicBody.getContactCache();
+    if (!cache.valid || cache.worldEpoch != world.getEpoch()) return false;
+    if (dynamicBody.isTryingToDropFromPlatform()) return false;
+    if (dynamicBody.getPosition() != cache.position) return false;
+
+    // same threshold the sweep uses for "not moving"
+    const sf::Vector2f displacement = dynamicBody.getVelocity() * deltaTime;
+    if (std::abs(displacement.x) >= 1e-5f || std::abs(displacement.y) >= 1e-5f) return false;
+
+    // the validation: same boxes around us as last time and none of them synced since,
+    // anything that moved in from outside shows up as an extra index
+    thread_local std::vector<std::size_t> nearby;
+    nearby.clear();
+    broadphase.query(contactSkin(dynamicBody), nearby);
+    if (nearby.size() != cache.touching.size()) return false;
+    for (std::size_t i = 0; i < nearby.size(); ++i) {
+        const auto& contact = cache.touching[i];
+        if (nearby[i] != contact.first || world.revision(contact.first) != contact.second) return false;
+    }
+
+    dynamicBody.setGroundPlatformTemporarilyIgnored(BodyHandle{});
+    outInfo = CollisionResolutionInfo{};
+    outInfo.onGround = true;
+    outInfo.groundPlatform = world.handleOf(cache.groundIndex);
+    outInfo.fromContactCache = true;
+    dynamicBody.setOnGround(true);
+    dynamicBody.setGroundPlatform(outInfo.groundPlatform);
+    return true;
+}
+
+void CollisionSystem::refreshContactCache(
+    DynamicBody& dynamicBody,
+    const CollisionWorld& world,
+    const DynamicAABBTree& broadphase,
+    const CollisionResolutionInfo& info)
+{
+    ContactCache& cache = dynamicBody.getContactCache();
+    cache.touching.clear();
+    cache.valid = false;
+    if (!info.onGround || !world.isValid(info.groundPlatform)) return;
+
+    const std::size_t groundIndex = info.groundPlatform.index;
+    if (!isRestingGround(world.type(groundIndex))) return;
+
+    thread_local std::vector<std::size_t> nearby;
+    nearby.clear();
+    broadphase.query(contactSkin(dynamicBody), nearby);
+    for (std::size_t index : nearby) {
+        cache.touching.emplace_back(index, world.revision(index));
+    }
+
+    cache.valid = true;
+    cache.worldEpoch = world.getEpoch();
+    cache.position = dynamicBody.getPosition();
+    cache.groundIndex = groundIndex;
+}
+
+std::vector<CollisionResolutionInfo> CollisionSystem::resolveCollisions(
+    std::vector<DynamicBody>& dynamicBodies,
+    const CollisionWorld& world,
+    const DynamicAABBTree& broadphase,
+    float deltaTime,
+    ThreadPool& pool)
+{
+    const std::size_t MIN_BODIES_PER_CHUNK = 16; // one body is a few microseconds, smaller chunks are all overhead
+
+    std::vector<CollisionResolutionInfo> results(dynamicBodies.size());
+    pool.parallelFor(dynamicBodies.size(), MIN_BODIES_PER_CHUNK,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                results[i] = resolveCollisions(dynamicBodies[i], world, broadphase, deltaTime);
+            }
+        });
+    return results;
+}
+
+void CollisionSystem::queryTriggers(
+    const sf::FloatRect& area,
+    const CollisionWorld& world,
+    const DynamicAABBTree& broadphase,
+    std::vector<TriggerHit>& outHits)
+{
+    thread_local std::vector<std::size_t> candidates;
+    candidates.clear();
+    outHits.clear();
+    broadphase.query(area, candidates);
+
+    const float areaMaxX = area.position.x + area.size.x;
+    const float areaMaxY = area.position.y + area.size.y;
+    for (std::size_t index : candidates) {
+        if (!(world.flags(index) & CollisionWorld::Trigger)) continue;
+        // fat boxes only say "maybe", same strict overlap as findIntersection for the real answer
+        if (std::max(area.position.x, world.minX(index)) < std::min(areaMaxX, world.maxX(index)) &&
+            std::max(area.position.y, world.minY(index)) < std::min(areaMaxY, world.maxY(index))) {
+            outHits.push_back({index, world.type(index)});
+        }
+    }
+}
+
+template <typename CandidateQuery>
+CollisionResolutionInfo CollisionSystem::resolveCollisionsImpl(
+    DynamicBody& dynamicBody,
+    const CollisionWorld& world,
+    float deltaTime,
+    CandidateQuery&& gatherCandidates)
 {
     CollisionResolutionInfo resolutionInfo;
     resolutionInfo.onGround = false;
-    resolutionInfo.groundPlatform = nullptr;
+    resolutionInfo.groundPlatform = BodyHandle{};
     resolutionInfo.hitCeiling = false;
     resolutionInfo.hitWallLeft = false;
     resolutionInfo.hitWallRight = false;
@@ -38,75 +216,113 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
     const float MIN_TIME_STEP = 1e-5f; // Minimum time to process to avoid tiny steps due to precision
 
 
-    dynamicBody.setGroundPlatformTemporarilyIgnored(nullptr); // Clear any temporary ignore from previous frame
+    dynamicBody.setGroundPlatformTemporarilyIgnored(BodyHandle{}); // Clear any temporary ignore from previous frame
 
     sf::Vector2f originalPlayerVelocity = dynamicBody.getVelocity(); // Store velocity at start of this tick
+    // scratch kept per thread, so the batch resolve doesn't hammer the allocator from every worker
+    thread_local std::vector<std::size_t> candidates;
+    thread_local PackedCandidates packed;
 
     for (int iter = 0; iter < MAX_COLLISION_ITERATIONS && timeRemaining > MIN_TIME_STEP; ++iter) {
         float earliestCollisionTOI = 1.0f + MIN_TIME_STEP; // Start slightly above 1.0 to ensure any valid TOI is less
         CollisionEvent nearestCollisionEvent;
         nearestCollisionEvent.time = earliestCollisionTOI; // Initialize nearest event time
-        const PlatformBody* hitPlatformInIter = nullptr;
+        BodyHandle hitPlatformInIter;
+        std::size_t hitIndexInIter = 0;
 
         sf::Vector2f currentFrameVelocity = dynamicBody.getVelocity(); // Velocity for *this iteration's* sweep
         sf::Vector2f sweepVector = currentFrameVelocity * timeRemaining;
 
-        // Broadphase (already implicitly done by iterating all platforms)
-        // Narrowphase
-        for (const auto& platform : platformBodies) {
-            if (platform.getType() == phys::bodyType::goal || platform.getType() == phys::bodyType::none || platform.getType() == phys::bodyType::trap || platform.getType() == phys::bodyType::portal) {
+        // Swept box only depends on the body, build it once per iteration instead of once per platform
+        sf::FloatRect dynamicBroadAABB = dynamicBody.getAABB();
+        if (sweepVector.x < 0) dynamicBroadAABB.position.x += sweepVector.x;
+        dynamicBroadAABB.size.x += std::abs(sweepVector.x);
+        if (sweepVector.y < 0) dynamicBroadAABB.position.y += sweepVector.y;
+        dynamicBroadAABB.size.y += std::abs(sweepVector.y);
+
+        // Broadphase
+        candidates.clear();
+        gatherCandidates(dynamicBroadAABB, candidates);
+
+        // Narrowphase, first pass filters and packs the survivors so the sweep can run as one batch
+        const sf::FloatRect bodyAABBAtSweepStart = dynamicBody.getAABB(); // Player's AABB before this iteration's sweepVector application
+        const float broadMaxX = dynamicBroadAABB.position.x + dynamicBroadAABB.size.x;
+        const float broadMaxY = dynamicBroadAABB.position.y + dynamicBroadAABB.size.y;
+        packed.clear();
+        for (std::size_t candidateIndex : candidates) {
+            const std::uint8_t platformFlags = world.flags(candidateIndex);
+            if (!(platformFlags & CollisionWorld::Collidable)) {
                 continue;
             }
-            if (&platform == dynamicBody.getGroundPlatformTemporarilyIgnored()) {
+            const BodyHandle platform = world.handleOf(candidateIndex);
+            if (platform == dynamicBody.getGroundPlatformTemporarilyIgnored()) {
                 continue;
             }
+            ++resolutionInfo.narrowphaseTests;
 
-            // Optional: AABB check for the sweep before detailed sweptAABB
-            sf::FloatRect dynamicBroadAABB = dynamicBody.getAABB();
-            if (sweepVector.x < 0) dynamicBroadAABB.position.x += sweepVector.x;
-            dynamicBroadAABB.size.x += std::abs(sweepVector.x);
-            if (sweepVector.y < 0) dynamicBroadAABB.position.y += sweepVector.y;
-            dynamicBroadAABB.size.y += std::abs(sweepVector.y);
+            const float platMinX = world.minX(candidateIndex);
+            const float platMinY = world.minY(candidateIndex);
+            const float platMaxX = world.maxX(candidateIndex);
+            const float platMaxY = world.maxY(candidateIndex);
 
-            if (!dynamicBroadAABB.findIntersection(platform.getAABB())) {
+            // same strict test as FloatRect::findIntersection, touching edges don't count
+            if (!(std::max(dynamicBroadAABB.position.x, platMinX) < std::min(broadMaxX, platMaxX) &&
+                  std::max(dynamicBroadAABB.position.y, platMinY) < std::min(broadMaxY, platMaxY))) {
                 continue;
             }
 
+            packed.push(candidateIndex, platMinX, platMinY, platMaxX, platMaxY);
+        }
 
-            CollisionEvent currentEventDetails;
-            if (sweptAABB(dynamicBody, sweepVector, platform, 1.0f, currentEventDetails)) { // maxTime for sweptAABB here is relative to sweepVector
-                // Filter collisions for one-way platforms (type == platform)
-                if (currentEventDetails.hitPlatform->getType() == phys::bodyType::platform) {
-                    // Player must be moving downwards (or nearly static but overlapping from above)
-                    // Collision must be on the Y-axis (top surface of platform)
-                    // Player's feet must be above or very slightly into the platform's top surface at the START of the sweepVector for this iteration
-                    sf::FloatRect bodyAABBAtSweepStart = dynamicBody.getAABB(); // Player's AABB before this iteration's sweepVector application
-                    bool canLandOnOneWay = (currentEventDetails.axis == 1 && // Y-axis collision normal (hit top/bottom of platform)
-                                         currentFrameVelocity.y >= -JUMP_THROUGH_TOLERANCE && // Player moving down, or very slightly up but overlapping
-                                         (bodyAABBAtSweepStart.position.y + bodyAABBAtSweepStart.size.y) <= (currentEventDetails.hitPlatform->getAABB().position.y + JUMP_THROUGH_TOLERANCE));
-
-                    // If player is trying to drop through this specific platform
-                    if (dynamicBody.isTryingToDropFromPlatform() && dynamicBody.getGroundPlatform() == currentEventDetails.hitPlatform) {
-                        dynamicBody.setGroundPlatformTemporarilyIgnored(currentEventDetails.hitPlatform);
-                        resolutionInfo.onGround = false; // No longer on this ground
-                        if (resolutionInfo.groundPlatform == currentEventDetails.hitPlatform) {
-                           resolutionInfo.groundPlatform = nullptr;
-                        }
-                        dynamicBody.setGroundPlatform(nullptr);
-                        continue; // Ignore this collision, try to fall through
-                    }
+        // relative to sweepVector, maxTime is always 1 here
+        packed.hits.resize(packed.size());
+        sweptAABBBatch(bodyAABBAtSweepStart, sweepVector,
+                       packed.minX.data(), packed.minY.data(), packed.maxX.data(), packed.maxY.data(),
+                       packed.size(), packed.hits.data());
+
+        // second pass in candidate order, only hits get the full scalar sweep for time/axis
+        for (std::size_t slot = 0; slot < packed.size(); ++slot) {
+            if (!packed.hits[slot]) {
+                continue;
+            }
+            const std::size_t candidateIndex = packed.indices[slot];
+            const BodyHandle platform = world.handleOf(candidateIndex);
+            const float platMinY = packed.minY[slot];
 
-                    if (!canLandOnOneWay) {
-                        continue; // Not a valid landing on this one-way platform, ignore it
+            CollisionEvent currentEventDetails;
+            sweepBox(bodyAABBAtSweepStart, sweepVector, packed.minX[slot], platMinY, packed.maxX[slot], packed.maxY[slot], currentEventDetails);
+            currentEventDetails.hitPlatform = platform;
+            // Filter collisions for one-way platforms (type == platform)
+            if (world.flags(candidateIndex) & CollisionWorld::OneWay) {
+                // Player must be moving downwards (or nearly static but overlapping from above)
+                // Collision must be on the Y-axis (top surface of platform)
+                // Player's feet must be above or very slightly into the platform's top surface at the START of the sweepVector for this iteration
+                bool canLandOnOneWay = (currentEventDetails.axis == 1 && // Y-axis collision normal (hit top/bottom of platform)
+                                     currentFrameVelocity.y >= -JUMP_THROUGH_TOLERANCE && // Player moving down, or very slightly up but overlapping
+                                     (bodyAABBAtSweepStart.position.y + bodyAABBAtSweepStart.size.y) <= (platMinY + JUMP_THROUGH_TOLERANCE));
+
+                // If player is trying to drop through this specific platform
+                if (dynamicBody.isTryingToDropFromPlatform() && dynamicBody.getGroundPlatform() == platform) {
+                    dynamicBody.setGroundPlatformTemporarilyIgnored(platform);
+                    resolutionInfo.onGround = false; // No longer on this ground
+                    if (resolutionInfo.groundPlatform == platform) {
+                       resolutionInfo.groundPlatform = BodyHandle{};
                     }
+                    dynamicBody.setGroundPlatform(BodyHandle{});
+                    continue; // Ignore this collision, try to fall through
                 }
 
-                // Update nearest collision if this one is earlier
-                if (currentEventDetails.time < nearestCollisionEvent.time) {
-                    nearestCollisionEvent = currentEventDetails;
-                    hitPlatformInIter = nearestCollisionEvent.hitPlatform; // Redundant but clear
+                if (!canLandOnOneWay) {
+                    continue; // Not a valid landing on this one-way platform, ignore it
                 }
             }
+
+            // Update nearest collision if this one is earlier
+            if (currentEventDetails.time < nearestCollisionEvent.time) {
+                nearestCollisionEvent = currentEventDetails;
+                hitPlatformInIter = platform;
+                hitIndexInIter = candidateIndex;
+            }
         }
 
         // Process the nearest collision for this iteration
@@ -123,7 +339,7 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
             // Apply collision response (e.g., stop velocity along collision normal)
             // Store the velocity *before* response, useful for platform interaction checks.
             sf::Vector2f velocityBeforeResponse = dynamicBody.getVelocity();
-            applyCollisionResponse(dynamicBody, nearestCollisionEvent, *hitPlatformInIter);
+            applyCollisionResponse(dynamicBody, nearestCollisionEvent, world.body(hitIndexInIter));
             sf::Vector2f velocityAfterResponse = dynamicBody.getVelocity();
 
 
@@ -132,8 +348,8 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
                 if (velocityBeforeResponse.y >= 0 && velocityAfterResponse.y == 0) { // Landed (was moving down or static, now Y velocity is zero)
                     resolutionInfo.onGround = true;
                     resolutionInfo.groundPlatform = hitPlatformInIter;
-                    if (hitPlatformInIter->getType() == phys::bodyType::conveyorBelt) {
-                        resolutionInfo.surfaceVelocity = hitPlatformInIter->getSurfaceVelocity();
+                    if (world.flags(hitIndexInIter) & CollisionWorld::Conveyor) {
+                        resolutionInfo.surfaceVelocity = world.surfaceVelocity(hitIndexInIter);
                     } else {
                         resolutionInfo.surfaceVelocity = {0.f, 0.f}; // Reset if not conveyor
                     }
@@ -142,7 +358,7 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
                      // If somehow thought it was on ground with this platform, unset it.
                     if (resolutionInfo.groundPlatform == hitPlatformInIter) {
                         resolutionInfo.onGround = false;
-                        resolutionInfo.groundPlatform = nullptr;
+                        resolutionInfo.groundPlatform = BodyHandle{};
                     }
                 }
             } else { // Collision with a vertical surface (axis == 0)
@@ -156,7 +372,7 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
             // If very small TOI (already overlapping or just touched), attempt depenetration
             if (nearestCollisionEvent.time < MIN_TIME_STEP) {
                 sf::FloatRect bodyAABB = dynamicBody.getAABB(); // Re-get AABB after moving to TOI
-                sf::FloatRect platAABB = hitPlatformInIter->getAABB();
+                sf::FloatRect platAABB = world.body(hitIndexInIter).getAABB();
                 sf::Vector2f penetrationDepth = {0.f, 0.f};
                 sf::Vector2f correction = {0.f, 0.f};
 
@@ -210,28 +426,42 @@ CollisionResolutionInfo CollisionSystem::resolveCollisions(
 bool CollisionSystem::sweptAABB(
     const DynamicBody& body,
     const sf::Vector2f& displacement, // This is velocity * timeRemaining for the current iteration
-    const PlatformBody& platform,
+    const CollisionWorld& world,
+    std::size_t platformIndex,
     float maxTime, // This should always be 1.0f as 'displacement' is the full potential move for this iteration
     CollisionEvent& outCollisionEvent)
 {
-    sf::FloatRect bodyRect = body.getAABB();
-    sf::FloatRect platRect = platform.getAABB();
+    if (!sweepBox(body.getAABB(), displacement,
+                  world.minX(platformIndex), world.minY(platformIndex),
+                  world.maxX(platformIndex), world.maxY(platformIndex),
+                  outCollisionEvent)) {
+        return false;
+    }
+    outCollisionEvent.hitPlatform = world.handleOf(platformIndex);
+    return true;
+}
 
+bool CollisionSystem::sweepBox(
+    const sf::FloatRect& bodyRect,
+    const sf::Vector2f& displacement,
+    float platMinX, float platMinY, float platMaxX, float platMaxY,
+    CollisionEvent& outCollisionEvent)
+{
     outCollisionEvent.time = 2.0f; // Initialize to a value greater than 1.0f
     outCollisionEvent.axis = -1;
-    outCollisionEvent.hitPlatform = nullptr;
+    outCollisionEvent.hitPlatform = BodyHandle{}; // callers fill this in, they know which platform it was
 
     // Handle zero displacement case (static overlap check)
     if (std::abs(displacement.x) < 1e-5f && std::abs(displacement.y) < 1e-5f) {
-        if (bodyRect.findIntersection(platRect)) {
+        if (std::max(bodyRect.position.x, platMinX) < std::min(bodyRect.position.x + bodyRect.size.x, platMaxX) &&
+            std::max(bodyRect.position.y, platMinY) < std::min(bodyRect.position.y + bodyRect.size.y, platMaxY)) {
             outCollisionEvent.time = 0.0f; // Immediate collision
-            outCollisionEvent.hitPlatform = &platform;
 
             // Determine axis for static overlap: axis of MINIMUM penetration is preferred for depenetration
-            float dx1 = (platRect.position.x + platRect.size.x) - bodyRect.position.x; // Right edge of plat - left edge of body
-            float dx2 = (bodyRect.position.x + bodyRect.size.x) - platRect.position.x; // Right edge of body - left edge of plat
-            float dy1 = (platRect.position.y + platRect.size.y) - bodyRect.position.y;   // Bottom edge of plat - top edge of body
-            float dy2 = (bodyRect.position.y + bodyRect.size.y) - platRect.position.y;   // Bottom edge of body - top edge of plat
+            float dx1 = platMaxX - bodyRect.position.x; // Right edge of plat - left edge of body
+            float dx2 = (bodyRect.position.x + bodyRect.size.x) - platMinX; // Right edge of body - left edge of plat
+            float dy1 = platMaxY - bodyRect.position.y;   // Bottom edge of plat - top edge of body
+            float dy2 = (bodyRect.position.y + bodyRect.size.y) - platMinY;   // Bottom edge of body - top edge of plat
 
             float xOverlap = std::min(dx1, dx2);
             float yOverlap = std::min(dy1, dy2);
@@ -259,15 +489,15 @@ bool CollisionSystem::sweptAABB(
     // Calculate collision times for X axis
     if (std::abs(displacement.x) > 1e-5f) {
         if (displacement.x > 0.f) { // Moving Right
-            entryTime.x = (platRect.position.x - (bodyRect.position.x + bodyRect.size.x)) / displacement.x;
-            exitTime.x = ((platRect.position.x + platRect.size.x) - bodyRect.position.x) / displacement.x;
+            entryTime.x = (platMinX - (bodyRect.position.x + bodyRect.size.x)) / displacement.x;
+            exitTime.x = (platMaxX - bodyRect.position.x) / displacement.x;
         } else { // Moving Left
-            entryTime.x = ((platRect.position.x + platRect.size.x) - bodyRect.position.x) / displacement.x;
-            exitTime.x = (platRect.position.x - (bodyRect.position.x + bodyRect.size.x)) / displacement.x;
+            entryTime.x = (platMaxX - bodyRect.position.x) / displacement.x;
+            exitTime.x = (platMinX - (bodyRect.position.x + bodyRect.size.x)) / displacement.x;
         }
     } else { // Static in X: check for current overlap in X
-        if (!(bodyRect.position.x + bodyRect.size.x <= platRect.position.x
-            || bodyRect.position.x >= platRect.position.x + platRect.size.x)) { // Overlapping in X
+        if (!(bodyRect.position.x + bodyRect.size.x <= platMinX
+            || bodyRect.position.x >= platMaxX)) { // Overlapping in X
             entryTime.x = -std::numeric_limits<float>::infinity(); // Can collide at any time during Y move
             exitTime.x = std::numeric_limits<float>::infinity();
         } // else, they are separate in X and not moving in X, so no X collision possible
@@ -276,15 +506,15 @@ bool CollisionSystem::sweptAABB(
     // Calculate collision times for Y axis
     if (std::abs(displacement.y) > 1e-5f) {
         if (displacement.y > 0.f) { // Moving Down
-            entryTime.y = (platRect.position.y - (bodyRect.position.y + bodyRect.size.y)) / displacement.y;
-            exitTime.y = ((platRect.position.y + platRect.size.y) - bodyRect.position.y) / displacement.y;
+            entryTime.y = (platMinY - (bodyRect.position.y + bodyRect.size.y)) / displacement.y;
+            exitTime.y = (platMaxY - bodyRect.position.y) / displacement.y;
         } else { // Moving Up
-            entryTime.y = ((platRect.position.y + platRect.size.y) - bodyRect.position.y) / displacement.y;
-            exitTime.y = (platRect.position.y - (bodyRect.position.y + bodyRect.size.y)) / displacement.y;
+            entryTime.y = (platMaxY - bodyRect.position.y) / displacement.y;
+            exitTime.y = (platMinY - (bodyRect.position.y + bodyRect.size.y)) / displacement.y;
         }
     } else { // Static in Y: check for current overlap in Y
-         if (!(bodyRect.position.y + bodyRect.size.y <= platRect.position.y
-            || bodyRect.position.y >= platRect.position.y + platRect.size.y)) { // Overlapping in Y
+         if (!(bodyRect.position.y + bodyRect.size.y <= platMinY
+            || bodyRect.position.y >= platMaxY)) { // Overlapping in Y
             entryTime.y = -std::numeric_limits<float>::infinity();
             exitTime.y = std::numeric_limits<float>::infinity();
         }
@@ -309,7 +539,6 @@ bool CollisionSystem::sweptAABB(
 
     // A collision will occur
     outCollisionEvent.time = firstEntry;
-    outCollisionEvent.hitPlatform = &platform;
 
     // Determine the collision normal (axis)
     // The axis where entryTime is GREATER determines the normal of the surface hit.
@@ -339,10 +568,10 @@ bool CollisionSystem::sweptAABB(
         } else {
             // Fallback for very ambiguous corners, e.g., check overlaps
              // Determine axis for static overlap: axis of MINIMUM penetration is preferred for depenetration
-            float dx1 = (platRect.position.x + platRect.size.x) - bodyRect.position.x; 
-            float dx2 = (bodyRect.position.x + bodyRect.size.x) - platRect.position.x; 
-            float dy1 = (platRect.position.y + platRect.size.y) - bodyRect.position.y;   
-            float dy2 = (bodyRect.position.y + bodyRect.size.y) - platRect.position.y;  
+            float dx1 = platMaxX - bodyRect.position.x; 
+            float dx2 = (bodyRect.position.x + bodyRect.size.x) - platMinX; 
+            float dy1 = platMaxY - bodyRect.position.y;   
+            float dy2 = (bodyRect.position.y + bodyRect.size.y) - platMinY;  
 
             float xOverlap = std::min(dx1, dx2);
             float yOverlap = std::min(dy1, dy2);
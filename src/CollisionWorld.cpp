@@ -0,0 +1,101 @@
+#include "CollisionWorld.hpp"
+
+namespace phys {
+
+std::uint8_t CollisionWorld::flagsFor(bodyType type) {
+    switch (type) {
+        case bodyType::none:
+            return 0;
+        case bodyType::goal:
+        case bodyType::trap:
+        case bodyType::portal:
+            return Trigger;
+        case bodyType::interactible:
+            return Collidable | Trigger;
+        case bodyType::platform:
+            return Collidable | OneWay;
+        case bodyType::conveyorBelt:
+            return Collidable | Conveyor;
+        default:
+            return Collidable;
+    }
+}
+
+void CollisionWorld::clear() {
+    m_source = nullptr;
+    m_minX.clear();
+    m_minY.clear();
+    m_maxX.clear();
+    m_maxY.clear();
+    m_flags.clear();
+    m_types.clear();
+    m_surfaceVelX.clear();
+    m_surfaceVelY.clear();
+    m_revisions.clear();
+    m_generations.clear();
+}
+
+void CollisionWorld::rebuild(const std::vector<PlatformBody>& platformBodies) {
+    clear();
+    m_source = &platformBodies;
+    ++m_epoch;
+
+    const std::size_t count = platformBodies.size();
+    m_minX.resize(count);
+    m_minY.resize(count);
+    m_maxX.resize(count);
+    m_maxY.resize(count);
+    m_flags.resize(count);
+    m_types.resize(count);
+    m_surfaceVelX.resize(count);
+    m_surfaceVelY.resize(count);
+    m_revisions.assign(count, 0);
+    m_generations.assign(count, ++m_lastGeneration);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        sync(i);
+    }
+}
+
+void CollisionWorld::resize(std::size_t count) {
+    const std::size_t oldCount = m_minX.size();
+    if (count <= oldCount) return;
+    m_minX.resize(count, 0.f);
+    m_minY.resize(count, 0.f);
+    m_maxX.resize(count, 0.f);
+    m_maxY.resize(count, 0.f);
+    m_flags.resize(count, 0);
+    m_types.resize(count, static_cast<std::uint8_t>(bodyType::none));
+    m_surfaceVelX.resize(count, 0.f);
+    m_surfaceVelY.resize(count, 0.f);
+    m_revisions.resize(count, 0);
+    m_generations.resize(count, ++m_lastGeneration);
+}
+
+void CollisionWorld::release(std::size_t index) {
+    if (index >= m_minX.size()) return;
+    m_flags[index] = 0;
+    m_types[index] = static_cast<std::uint8_t>(bodyType::none);
+    m_surfaceVelX[index] = 0.f;
+    m_surfaceVelY[index] = 0.f;
+    // the revision keeps counting, a cached contact on the slot can't match whatever moves in next
+    ++m_revisions[index];
+    m_generations[index] = ++m_lastGeneration;
+}
+
+void CollisionWorld::sync(std::size_t index) {
+    if (!m_source || index >= m_minX.size()) return;
+    const PlatformBody& platform = (*m_source)[index];
+
+    m_minX[index] = platform.getPosition().x;
+    m_minY[index] = platform.getPosition().y;
+    m_maxX[index] = platform.getPosition().x + platform.getWidth();
+    m_maxY[index] = platform.getPosition().y + platform.getHeight();
+    m_types[index] = static_cast<std::uint8_t>(platform.getType());
+    m_flags[index] = flagsFor(platform.getType());
+    m_surfaceVelX[index] = platform.getSurfaceVelocity().x;
+    m_surfaceVelY[index] = platform.getSurfaceVelocity().y;
+    ++m_revisions[index];
+}
+
+} // namespace phys
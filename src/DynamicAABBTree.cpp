@@ -0,0 +1,359 @@
+#include "DynamicAABBTree.hpp"
+#include <algorithm>
+
+// tree layout and rotations follow the usual box2d style dynamic tree, boxes are stored as min/max
+// so unions and containment checks don't keep converting from position/size
+
+namespace phys {
+
+namespace {
+    struct BoxOps {
+        template <typename B>
+        static B combine(const B& a, const B& b) {
+            B out;
+            out.minX = std::min(a.minX, b.minX);
+            out.minY = std::min(a.minY, b.minY);
+            out.maxX = std::max(a.maxX, b.maxX);
+            out.maxY = std::max(a.maxY, b.maxY);
+            return out;
+        }
+        template <typename B>
+        static float perimeter(const B& b) {
+            return 2.f * ((b.maxX - b.minX) + (b.maxY - b.minY));
+        }
+        template <typename B>
+        static bool contains(const B& outer, const B& inner) {
+            return outer.minX <= inner.minX && outer.minY <= inner.minY
+                && inner.maxX <= outer.maxX && inner.maxY <= outer.maxY;
+        }
+        template <typename B>
+        static bool overlaps(const B& a, const B& b) {
+            return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+        }
+    };
+}
+
+DynamicAABBTree::DynamicAABBTree(float fatMargin)
+    : m_fatMargin(fatMargin > 0.f ? fatMargin : 0.f) {}
+
+void DynamicAABBTree::clear() {
+    m_nodes.clear();
+    m_bodyProxies.clear();
+    m_root = NullNode;
+    m_freeList = NullNode;
+    m_proxyCount = 0;
+    m_reinsertCount = 0;
+}
+
+void DynamicAABBTree::build(const std::vector<PlatformBody>& platformBodies) {
+    clear();
+    m_nodes.reserve(platformBodies.size() * 2);
+    m_bodyProxies.reserve(platformBodies.size());
+    for (std::size_t i = 0; i < platformBodies.size(); ++i) {
+        m_bodyProxies.push_back(createProxy(platformBodies[i].getAABB(), static_cast<std::uint32_t>(i)));
+    }
+    m_reinsertCount = 0;
+}
+
+bool DynamicAABBTree::updateBody(std::size_t bodyIndex, const sf::FloatRect& aabb) {
+    if (bodyIndex >= m_bodyProxies.size()) return false;
+    return moveProxy(m_bodyProxies[bodyIndex], aabb);
+}
+
+void DynamicAABBTree::insertBody(std::size_t bodyIndex, const sf::FloatRect& aabb) {
+    if (bodyIndex >= m_bodyProxies.size()) m_bodyProxies.resize(bodyIndex + 1, NullNode);
+    if (m_bodyProxies[bodyIndex] != NullNode) destroyProxy(m_bodyProxies[bodyIndex]);
+    m_bodyProxies[bodyIndex] = createProxy(aabb, static_cast<std::uint32_t>(bodyIndex));
+}
+
+void DynamicAABBTree::removeBody(std::size_t bodyIndex) {
+    if (bodyIndex >= m_bodyProxies.size() || m_bodyProxies[bodyIndex] == NullNode) return;
+    destroyProxy(m_bodyProxies[bodyIndex]);
+    m_bodyProxies[bodyIndex] = NullNode;
+}
+
+DynamicAABBTree::Box DynamicAABBTree::fatten(const sf::FloatRect& aabb) const {
+    Box b;
+    b.minX = aabb.position.x - m_fatMargin;
+    b.minY = aabb.position.y - m_fatMargin;
+    b.maxX = aabb.position.x + aabb.size.x + m_fatMargin;
+    b.maxY = aabb.position.y + aabb.size.y + m_fatMargin;
+    return b;
+}
+
+int DynamicAABBTree::allocateNode() {
+    if (m_freeList == NullNode) {
+        m_nodes.emplace_back();
+        m_freeList = static_cast<int>(m_nodes.size()) - 1;
+    }
+    int nodeId = m_freeList;
+    m_freeList = m_nodes[nodeId].next;
+    Node& node = m_nodes[nodeId];
+    node = Node();
+    node.height = 0;
+    return nodeId;
+}
+
+void DynamicAABBTree::freeNode(int nodeId) {
+    m_nodes[nodeId].next = m_freeList;
+    m_nodes[nodeId].height = -1;
+    m_freeList = nodeId;
+}
+
+int DynamicAABBTree::createProxy(const sf::FloatRect& aabb, std::uint32_t bodyIndex) {
+    int proxyId = allocateNode();
+    m_nodes[proxyId].box = fatten(aabb);
+    m_nodes[proxyId].bodyIndex = bodyIndex;
+    insertLeaf(proxyId);
+    ++m_proxyCount;
+    return proxyId;
+}
+
+void DynamicAABBTree::destroyProxy(int proxyId) {
+    if (proxyId < 0 || proxyId >= static_cast<int>(m_nodes.size()) || !m_nodes[proxyId].isLeaf()) return;
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --m_proxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(int proxyId, const sf::FloatRect& aabb) {
+    if (proxyId < 0 || proxyId >= static_cast<int>(m_nodes.size())) return false;
+
+    Box tight;
+    tight.minX = aabb.position.x;
+    tight.minY = aabb.position.y;
+    tight.maxX = aabb.position.x + aabb.size.x;
+    tight.maxY = aabb.position.y + aabb.size.y;
+    if (BoxOps::contains(m_nodes[proxyId].box, tight)) {
+        return false; // still inside its fat box, nothing to do
+    }
+
+    removeLeaf(proxyId);
+    m_nodes[proxyId].box = fatten(aabb);
+    insertLeaf(proxyId);
+    ++m_reinsertCount;
+    return true;
+}
+
+void DynamicAABBTree::insertLeaf(int leaf) {
+    if (m_root == NullNode) {
+        m_root = leaf;
+        m_nodes[m_root].parent = NullNode;
+        return;
+    }
+
+    // walk down picking the cheaper child by surface area heuristic
+    Box leafBox = m_nodes[leaf].box;
+    int index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        int child1 = m_nodes[index].child1;
+        int child2 = m_nodes[index].child2;
+
+        float area = BoxOps::perimeter(m_nodes[index].box);
+        float combinedArea = BoxOps::perimeter(BoxOps::combine(m_nodes[index].box, leafBox));
+        float cost = 2.f * combinedArea;
+        float inheritanceCost = 2.f * (combinedArea - area);
+
+        auto descendCost = [&](int child) {
+            float enlarged = BoxOps::perimeter(BoxOps::combine(leafBox, m_nodes[child].box));
+            if (m_nodes[child].isLeaf()) return enlarged + inheritanceCost;
+            return (enlarged - BoxOps::perimeter(m_nodes[child].box)) + inheritanceCost;
+        };
+        float cost1 = descendCost(child1);
+        float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int sibling = index;
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].box = BoxOps::combine(leafBox, m_nodes[sibling].box);
+    m_nodes[newParent].height = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != NullNode) {
+        if (m_nodes[oldParent].child1 == sibling) m_nodes[oldParent].child1 = newParent;
+        else m_nodes[oldParent].child2 = newParent;
+    } else {
+        m_root = newParent;
+    }
+
+    refitUpwards(m_nodes[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = NullNode;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != NullNode) {
+        if (m_nodes[grandParent].child1 == parent) m_nodes[grandParent].child1 = sibling;
+        else m_nodes[grandParent].child2 = sibling;
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refitUpwards(grandParent);
+    } else {
+        m_root = sibling;
+        m_nodes[sibling].parent = NullNode;
+        freeNode(parent);
+    }
+    m_nodes[leaf].parent = NullNode;
+}
+
+void DynamicAABBTree::refitUpwards(int nodeId) {
+    int index = nodeId;
+    while (index != NullNode) {
+        index = balance(index);
+        int child1 = m_nodes[index].child1;
+        int child2 = m_nodes[index].child2;
+        m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+        m_nodes[index].box = BoxOps::combine(m_nodes[child1].box, m_nodes[child2].box);
+        index = m_nodes[index].parent;
+    }
+}
+
+// single rotation to keep sibling heights within 1 of each other, returns the new subtree root
+int DynamicAABBTree::balance(int iA) {
+    Node& A = m_nodes[iA];
+    if (A.isLeaf() || A.height < 2) return iA;
+
+    int iB = A.child1;
+    int iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+    int heightDiff = C.height - B.height;
+
+    auto reparent = [this](int oldChild, int newChild, int parentId) {
+        if (parentId == NullNode) {
+            m_root = newChild;
+        } else if (m_nodes[parentId].child1 == oldChild) {
+            m_nodes[parentId].child1 = newChild;
+        } else {
+            m_nodes[parentId].child2 = newChild;
+        }
+    };
+
+    if (heightDiff > 1) { // rotate C up
+        int iF = C.child1;
+        int iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+        reparent(iA, iC, C.parent);
+
+        if (F.height > G.height) {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.box = BoxOps::combine(B.box, G.box);
+            C.box = BoxOps::combine(A.box, F.box);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        } else {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.box = BoxOps::combine(B.box, F.box);
+            C.box = BoxOps::combine(A.box, G.box);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+        return iC;
+    }
+
+    if (heightDiff < -1) { // rotate B up
+        int iD = B.child1;
+        int iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+        reparent(iA, iB, B.parent);
+
+        if (D.height > E.height) {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.box = BoxOps::combine(C.box, E.box);
+            B.box = BoxOps::combine(A.box, D.box);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        } else {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.box = BoxOps::combine(C.box, D.box);
+            B.box = BoxOps::combine(A.box, E.box);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+void DynamicAABBTree::query(const sf::FloatRect& area, std::vector<std::size_t>& outIndices) const {
+    if (m_root == NullNode) return;
+
+    Box queryBox;
+    queryBox.minX = area.position.x;
+    queryBox.minY = area.position.y;
+    queryBox.maxX = area.position.x + area.size.x;
+    queryBox.maxY = area.position.y + area.size.y;
+
+    std::size_t firstNew = outIndices.size();
+    // local stack so concurrent const queries don't share state
+    int stackBuffer[64];
+    std::vector<int> overflow;
+    int stackSize = 0;
+    auto push = [&](int nodeId) {
+        if (stackSize < 64) stackBuffer[stackSize++] = nodeId;
+        else overflow.push_back(nodeId);
+    };
+    push(m_root);
+
+    while (stackSize > 0 || !overflow.empty()) {
+        int nodeId;
+        if (!overflow.empty()) { nodeId = overflow.back(); overflow.pop_back(); }
+        else nodeId = stackBuffer[--stackSize];
+
+        const Node& node = m_nodes[nodeId];
+        if (!BoxOps::overlaps(node.box, queryBox)) continue;
+        if (node.isLeaf()) {
+            outIndices.push_back(node.bodyIndex);
+        } else {
+            push(node.child1);
+            push(node.child2);
+        }
+    }
+
+    std::sort(outIndices.begin() + firstNew, outIndices.end());
+}
+
+sf::FloatRect DynamicAABBTree::getFatAABB(int proxyId) const {
+    const Box& b = m_nodes[proxyId].box;
+    return sf::FloatRect({b.minX, b.minY}, {b.maxX - b.minX, b.maxY - b.minY});
+}
+
+int DynamicAABBTree::getHeight() const {
+    return m_root == NullNode ? 0 : m_nodes[m_root].height;
+}
+
+} // namespace phys
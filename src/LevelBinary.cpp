@@ -0,0 +1,622 @@
+#include "LevelBinary.hpp"
+#include "LevelManager.hpp"
+#include "PhysicsTypes.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr std::size_t SECTION_ALIGNMENT = 16;
+
+    // bytes per element of every section, same order as LevelBinary::Section
+    constexpr std::size_t SECTION_ELEMENT_SIZE[LevelBinary::SectionCount] = {
+        sizeof(std::uint32_t), sizeof(std::uint32_t), sizeof(char),
+        sizeof(std::uint32_t), sizeof(float), sizeof(float), sizeof(float), sizeof(float),
+        sizeof(float), sizeof(float), sizeof(std::uint32_t), sizeof(float), sizeof(float),
+        sizeof(std::uint32_t), sizeof(std::uint8_t), sizeof(std::uint8_t),
+        sizeof(LevelBinary::MovingRecord), sizeof(LevelBinary::InteractibleRecord),
+        sizeof(LevelBinary::PortalRecord), sizeof(LevelBinary::DimensionRecord),
+        sizeof(std::uint32_t),
+        sizeof(LevelBinary::AnimationRecord), sizeof(LevelBinary::AnimationFrameRecord),
+        sizeof(LevelBinary::ChunkRecord), sizeof(std::uint32_t)
+    };
+
+    std::uint32_t packColor(const sf::Color& color) {
+        return std::uint32_t(color.r) | (std::uint32_t(color.g) << 8) | (std::uint32_t(color.b) << 16) | (std::uint32_t(color.a) << 24);
+    }
+
+    sf::Color unpackColor(std::uint32_t rgba) {
+        return sf::Color(rgba & 0xFF, (rgba >> 8) & 0xFF, (rgba >> 16) & 0xFF, (rgba >> 24) & 0xFF);
+    }
+
+    // every string goes in once, repeated texture paths cost one index each
+    class StringTable {
+    public:
+        std::uint32_t intern(const std::string& value) {
+            auto it = m_lookup.find(value);
+            if (it != m_lookup.end()) return it->second;
+            const std::uint32_t index = static_cast<std::uint32_t>(m_offsets.size());
+            m_offsets.push_back(static_cast<std::uint32_t>(m_bytes.size()));
+            m_lengths.push_back(static_cast<std::uint32_t>(value.size()));
+            m_bytes.insert(m_bytes.end(), value.begin(), value.end());
+            m_lookup.emplace(value, index);
+            return index;
+        }
+
+        const std::vector<std::uint32_t>& offsets() const { return m_offsets; }
+        const std::vector<std::uint32_t>& lengths() const { return m_lengths; }
+        const std::vector<char>& bytes() const { return m_bytes; }
+
+    private:
+        std::unordered_map<std::string, std::uint32_t> m_lookup;
+        std::vector<std::uint32_t> m_offsets;
+        std::vector<std::uint32_t> m_lengths;
+        std::vector<char> m_bytes;
+    };
+
+    struct SectionBlob {
+        const void* data = nullptr;
+        std::size_t count = 0;
+    };
+
+    template <typename T>
+    SectionBlob blobOf(const std::vector<T>& values) {
+        return SectionBlob{values.data(), values.size()};
+    }
+
+    // checked view over the mapped bytes, a section pointer is only handed out once its range is inside the file
+    class BlobReader {
+    public:
+        BlobReader(const std::uint8_t* data, std::size_t size) : m_data(data), m_size(size) {}
+
+        bool init() {
+            if (m_size < sizeof(LevelBinary::Header)) return false;
+            std::memcpy(&m_header, m_data, sizeof(m_header));
+            if (m_header.magic != LevelBinary::Magic) return false;
+            if (m_header.version != LevelBinary::Version) return false;
+            if (m_header.fileSize != m_size || m_header.sectionCount != LevelBinary::SectionCount) return false;
+            const std::size_t tableEnd = sizeof(LevelBinary::Header) + sizeof(m_sections);
+            if (m_size < tableEnd) return false;
+            std::memcpy(m_sections, m_data + sizeof(LevelBinary::Header), sizeof(m_sections));
+
+            for (std::uint32_t s = 0; s < LevelBinary::SectionCount; ++s) {
+                const LevelBinary::SectionEntry& entry = m_sections[s];
+                const std::size_t bytes = std::size_t(entry.count) * SECTION_ELEMENT_SIZE[s];
+                if (entry.offset % SECTION_ALIGNMENT != 0 || entry.offset < tableEnd) return false;
+                if (entry.offset > m_size || bytes > m_size - entry.offset) return false;
+            }
+            return true;
+        }
+
+        const LevelBinary::Header& header() const { return m_header; }
+        std::uint32_t count(LevelBinary::Section section) const { return m_sections[section].count; }
+
+        template <typename T>
+        const T* array(LevelBinary::Section section) const {
+            return reinterpret_cast<const T*>(m_data + m_sections[section].offset);
+        }
+
+        bool string(std::uint32_t index, std::string& out) const {
+            if (index >= count(LevelBinary::StringOffsets) || count(LevelBinary::StringLengths) != count(LevelBinary::StringOffsets)) return false;
+            const std::uint32_t offset = array<std::uint32_t>(LevelBinary::StringOffsets)[index];
+            const std::uint32_t length = array<std::uint32_t>(LevelBinary::StringLengths)[index];
+            const std::uint32_t total = count(LevelBinary::StringBytes);
+            if (offset > total || length > total - offset) return false;
+            out.assign(array<char>(LevelBinary::StringBytes) + offset, length);
+            return true;
+        }
+
+    private:
+        const std::uint8_t* m_data;
+        std::size_t m_size;
+        LevelBinary::Header m_header{};
+        LevelBinary::SectionEntry m_sections[LevelBinary::SectionCount]{};
+    };
+
+    bool platformArraysAgree(const BlobReader& blob) {
+        const std::uint32_t platformCount = blob.count(LevelBinary::PlatformId);
+        for (std::uint32_t s = LevelBinary::PlatformId; s <= LevelBinary::PlatformFalling; ++s) {
+            if (blob.count(static_cast<LevelBinary::Section>(s)) != platformCount) return false;
+        }
+        return true;
+    }
+
+    // platforms [first, first + count) of the arrays appended to out, stringAt turns a string index into a path (nullptr if bad)
+    template <typename StringLookup>
+    bool readPlatforms(const BlobReader& blob, std::uint32_t first, std::uint32_t count, StringLookup&& stringAt, std::vector<phys::PlatformBody>& out) {
+        const std::uint32_t* ids = blob.array<std::uint32_t>(LevelBinary::PlatformId);
+        const float* posX = blob.array<float>(LevelBinary::PlatformPosX);
+        const float* posY = blob.array<float>(LevelBinary::PlatformPosY);
+        const float* widths = blob.array<float>(LevelBinary::PlatformWidth);
+        const float* heights = blob.array<float>(LevelBinary::PlatformHeight);
+        const float* surfaceX = blob.array<float>(LevelBinary::PlatformSurfaceVelX);
+        const float* surfaceY = blob.array<float>(LevelBinary::PlatformSurfaceVelY);
+        const std::uint32_t* portalIds = blob.array<std::uint32_t>(LevelBinary::PlatformPortalId);
+        const float* teleportX = blob.array<float>(LevelBinary::PlatformTeleportX);
+        const float* teleportY = blob.array<float>(LevelBinary::PlatformTeleportY);
+        const std::uint32_t* textures = blob.array<std::uint32_t>(LevelBinary::PlatformTexture);
+        const std::uint8_t* types = blob.array<std::uint8_t>(LevelBinary::PlatformType);
+        const std::uint8_t* falling = blob.array<std::uint8_t>(LevelBinary::PlatformFalling);
+
+        out.reserve(out.size() + count);
+        for (std::uint32_t i = first; i < first + count; ++i) {
+            const std::string* texturePath = stringAt(textures[i]);
+            if (!texturePath || types[i] > static_cast<std::uint8_t>(phys::bodyType::portal)) {
+                std::cerr << "LevelBinary Error: Platform " << i << " is corrupt." << std::endl;
+                return false;
+            }
+            out.emplace_back(
+                ids[i], sf::Vector2f{posX[i], posY[i]}, widths[i], heights[i], static_cast<phys::bodyType>(types[i]),
+                falling[i] != 0, sf::Vector2f{surfaceX[i], surfaceY[i]}, *texturePath
+            );
+            out.back().setPortalID(portalIds[i]);
+            out.back().setTeleportOffset({teleportX[i], teleportY[i]});
+        }
+        return true;
+    }
+
+    void readDimensions(const BlobReader& blob, std::uint32_t first, std::uint32_t count, std::map<int, sf::IntRect>& out) {
+        const LevelBinary::DimensionRecord* dimensions = blob.array<LevelBinary::DimensionRecord>(LevelBinary::DimensionTable);
+        for (std::uint32_t i = first; i < first + count; ++i) {
+            out.emplace(static_cast<int>(dimensions[i].id),
+                sf::IntRect({dimensions[i].left, dimensions[i].top}, {dimensions[i].width, dimensions[i].height}));
+        }
+    }
+
+    // a run [first, first + count) inside a section of total elements, without overflowing
+    bool runFits(std::uint32_t first, std::uint32_t count, std::uint32_t total) {
+        return first <= total && count <= total - first;
+    }
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (view) {
+                    m_fileHandle = file;
+                    m_mappingHandle = mapping;
+                    m_data = static_cast<const std::uint8_t*>(view);
+                    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+                    m_mapped = true;
+                    return true;
+                }
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED) {
+                ::close(fd); // the mapping keeps the file alive
+                m_data = static_cast<const std::uint8_t*>(view);
+                m_size = static_cast<std::size_t>(info.st_size);
+                m_mapped = true;
+                return true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    // no mapping, just read the thing
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    const std::streamsize length = in.tellg();
+    if (length <= 0) return false;
+    m_fallback.resize(static_cast<std::size_t>(length));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(m_fallback.data()), length)) {
+        m_fallback.clear();
+        return false;
+    }
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+        CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+#else
+        munmap(const_cast<std::uint8_t*>(m_data), m_size);
+#endif
+    }
+    m_fallback.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+}
+
+bool LevelBinary::write(const std::string& path, const LevelData& levelData, const std::vector<std::string>& texturePaths) {
+    StringTable strings;
+
+    // a partitioned level goes down chunk by chunk, each chunk's platforms and dimensions in one run
+    std::vector<const phys::PlatformBody*> platforms;
+    std::vector<DimensionRecord> dimensions;
+    std::vector<ChunkRecord> chunks;
+    std::vector<std::uint32_t> chunkTextures;
+    auto addDimensions = [&dimensions](const std::map<int, sf::IntRect>& rects) {
+        for (const auto& [id, rect] : rects) {
+            dimensions.push_back(DimensionRecord{static_cast<std::uint32_t>(id), rect.position.x, rect.position.y, rect.size.x, rect.size.y});
+        }
+    };
+    if (levelData.chunks.empty()) {
+        platforms.reserve(levelData.platforms.size());
+        for (const phys::PlatformBody& platform : levelData.platforms) platforms.push_back(&platform);
+        addDimensions(levelData.TexturesDimensions);
+    } else {
+        chunks.reserve(levelData.chunks.size());
+        for (const LevelData::Chunk& chunk : levelData.chunks) {
+            if (chunk.platforms.size() != chunk.platformCount) {
+                std::cerr << "LevelBinary Error: " << path << ": the level's chunks aren't in memory, write it from the json." << std::endl;
+                return false;
+            }
+            ChunkRecord record{};
+            record.cellX = chunk.cell.x;
+            record.cellY = chunk.cell.y;
+            record.left = chunk.bounds.position.x;
+            record.top = chunk.bounds.position.y;
+            record.width = chunk.bounds.size.x;
+            record.height = chunk.bounds.size.y;
+            record.firstPlatform = static_cast<std::uint32_t>(platforms.size());
+            record.platformCount = static_cast<std::uint32_t>(chunk.platforms.size());
+            for (const phys::PlatformBody& platform : chunk.platforms) platforms.push_back(&platform);
+            record.firstDimension = static_cast<std::uint32_t>(dimensions.size());
+            addDimensions(chunk.dimensions);
+            record.dimensionCount = static_cast<std::uint32_t>(dimensions.size()) - record.firstDimension;
+            record.firstTexture = static_cast<std::uint32_t>(chunkTextures.size());
+            for (const std::string& texturePath : chunk.texturePaths) chunkTextures.push_back(strings.intern(texturePath));
+            record.textureCount = static_cast<std::uint32_t>(chunk.texturePaths.size());
+            chunks.push_back(record);
+        }
+    }
+    const std::size_t platformCount = platforms.size();
+
+    std::vector<std::uint32_t> ids(platformCount), portalIds(platformCount), textures(platformCount);
+    std::vector<float> posX(platformCount), posY(platformCount), widths(platformCount), heights(platformCount);
+    std::vector<float> surfaceX(platformCount), surfaceY(platformCount), teleportX(platformCount), teleportY(platformCount);
+    std::vector<std::uint8_t> types(platformCount), falling(platformCount);
+
+    for (std::size_t i = 0; i < platformCount; ++i) {
+        const phys::PlatformBody& platform = *platforms[i];
+        ids[i] = platform.getID();
+        posX[i] = platform.getPosition().x;
+        posY[i] = platform.getPosition().y;
+        widths[i] = platform.getWidth();
+        heights[i] = platform.getHeight();
+        surfaceX[i] = platform.getSurfaceVelocity().x;
+        surfaceY[i] = platform.getSurfaceVelocity().y;
+        portalIds[i] = platform.getPortalID();
+        teleportX[i] = platform.getTeleportOffset().x;
+        teleportY[i] = platform.getTeleportOffset().y;
+        textures[i] = strings.intern(platform.getTexturePath());
+        types[i] = static_cast<std::uint8_t>(platform.getType());
+        falling[i] = platform.isFalling() ? 1 : 0;
+    }
+
+    std::vector<MovingRecord> moving;
+    moving.reserve(levelData.movingPlatformDetails.size());
+    for (const LevelData::MovingPlatformInfo& info : levelData.movingPlatformDetails) {
+        MovingRecord record{};
+        record.id = info.id;
+        record.startX = info.startPosition.x;
+        record.startY = info.startPosition.y;
+        record.distance = info.distance;
+        record.cycleDuration = info.cycleDuration;
+        record.initialDirection = info.initialDirection;
+        record.axis = static_cast<std::uint8_t>(info.axis);
+        moving.push_back(record);
+    }
+
+    std::vector<InteractibleRecord> interactibles;
+    interactibles.reserve(levelData.interactiblePlatformDetails.size());
+    for (const LevelData::InteractiblePlatformInfo& info : levelData.interactiblePlatformDetails) {
+        InteractibleRecord record{};
+        record.id = info.id;
+        record.interactionType = strings.intern(info.interactionType);
+        record.targetBodyType = strings.intern(info.targetBodyTypeStr);
+        record.targetTileColor = packColor(info.targetTileColor);
+        record.cooldown = info.cooldown;
+        record.linkedID = info.linkedID;
+        record.hasTargetTileColor = info.hasTargetTileColor ? 1 : 0;
+        record.oneTime = info.oneTime ? 1 : 0;
+        interactibles.push_back(record);
+    }
+
+    std::vector<PortalRecord> portals;
+    portals.reserve(levelData.portalPlatformDetails.size());
+    for (const LevelData::PortalPlatformInfo& info : levelData.portalPlatformDetails) {
+        portals.push_back(PortalRecord{info.id, info.portalID, info.offset.x, info.offset.y});
+    }
+
+    std::vector<AnimationRecord> animations;
+    std::vector<AnimationFrameRecord> animationFrames;
+    animations.reserve(levelData.animationDetails.size());
+    for (const LevelData::AnimationInfo& info : levelData.animationDetails) {
+        AnimationRecord record{};
+        record.id = info.id;
+        record.firstFrame = static_cast<std::uint32_t>(animationFrames.size());
+        record.frameCount = static_cast<std::uint32_t>(info.frames.size());
+        record.loop = static_cast<std::uint8_t>(info.loop);
+        record.autoplay = info.autoplay ? 1 : 0;
+        animations.push_back(record);
+        for (std::size_t f = 0; f < info.frames.size(); ++f) {
+            const sf::IntRect& rect = info.frames[f];
+            animationFrames.push_back(AnimationFrameRecord{rect.position.x, rect.position.y, rect.size.x, rect.size.y, info.durations[f]});
+        }
+    }
+
+    std::vector<std::uint32_t> textureTable;
+    textureTable.reserve(texturePaths.size());
+    for (const std::string& texturePath : texturePaths) textureTable.push_back(strings.intern(texturePath));
+
+    Header header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.sectionCount = SectionCount;
+    header.levelNumber = levelData.levelNumber;
+    header.levelName = strings.intern(levelData.levelName);
+    header.backgroundTexture = levelData.backgroundTexturePath.empty() ? NoString : strings.intern(levelData.backgroundTexturePath);
+    header.backgroundColor = packColor(levelData.backgroundColor);
+    header.playerStartX = levelData.playerStartPosition.x;
+    header.playerStartY = levelData.playerStartPosition.y;
+    header.chunkSize = chunks.empty() ? 0.f : levelData.chunkSize;
+
+    const SectionBlob blobs[SectionCount] = {
+        blobOf(strings.offsets()), blobOf(strings.lengths()), blobOf(strings.bytes()),
+        blobOf(ids), blobOf(posX), blobOf(posY), blobOf(widths), blobOf(heights),
+        blobOf(surfaceX), blobOf(surfaceY), blobOf(portalIds), blobOf(teleportX), blobOf(teleportY),
+        blobOf(textures), blobOf(types), blobOf(falling),
+        blobOf(moving), blobOf(interactibles), blobOf(portals), blobOf(dimensions),
+        blobOf(textureTable),
+        blobOf(animations), blobOf(animationFrames),
+        blobOf(chunks), blobOf(chunkTextures)
+    };
+
+    SectionEntry sections[SectionCount];
+    std::size_t cursor = sizeof(Header) + sizeof(sections);
+    for (std::uint32_t s = 0; s < SectionCount; ++s) {
+        cursor = (cursor + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+        sections[s].offset = static_cast<std::uint32_t>(cursor);
+        sections[s].count = static_cast<std::uint32_t>(blobs[s].count);
+        cursor += blobs[s].count * SECTION_ELEMENT_SIZE[s];
+    }
+    header.fileSize = static_cast<std::uint32_t>(cursor);
+
+    std::vector<std::uint8_t> file(cursor, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+    std::memcpy(file.data() + sizeof(header), sections, sizeof(sections));
+    for (std::uint32_t s = 0; s < SectionCount; ++s) {
+        if (blobs[s].count == 0) continue;
+        std::memcpy(file.data() + sections[s].offset, blobs[s].data, blobs[s].count * SECTION_ELEMENT_SIZE[s]);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()))) {
+        std::cerr << "LevelBinary Error: Could not write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool LevelBinary::read(const std::uint8_t* data, std::size_t size, LevelData& outLevelData, std::vector<std::string>& outTexturePaths) {
+    BlobReader blob(data, size);
+    if (!data || !blob.init()) {
+        std::cerr << "LevelBinary Error: Not a version " << Version << " level blob." << std::endl;
+        return false;
+    }
+
+    const Header& header = blob.header();
+    const std::uint32_t platformCount = blob.count(PlatformId);
+    if (!platformArraysAgree(blob)) {
+        std::cerr << "LevelBinary Error: Platform arrays disagree on the platform count." << std::endl;
+        return false;
+    }
+
+    outLevelData.platforms.clear();
+    outLevelData.movingPlatformDetails.clear();
+    outLevelData.interactiblePlatformDetails.clear();
+    outLevelData.portalPlatformDetails.clear();
+    outLevelData.TexturesDimensions.clear();
+    outLevelData.animationDetails.clear();
+    outLevelData.chunks.clear();
+    outLevelData.chunkSize = 0.f;
+    outLevelData.chunkFile.reset();
+    outTexturePaths.clear();
+
+    if (!blob.string(header.levelName, outLevelData.levelName)) return false;
+    outLevelData.backgroundTexturePath.clear();
+    if (header.backgroundTexture != NoString && !blob.string(header.backgroundTexture, outLevelData.backgroundTexturePath)) return false;
+    outLevelData.levelNumber = header.levelNumber;
+    outLevelData.playerStartPosition = {header.playerStartX, header.playerStartY};
+    outLevelData.backgroundColor = unpackColor(header.backgroundColor);
+
+    // texture paths repeat a lot, turn each interned index into a std::string once
+    std::vector<std::string> stringCache(blob.count(StringOffsets));
+    std::vector<std::uint8_t> stringCached(stringCache.size(), 0);
+    auto cachedString = [&](std::uint32_t index) -> const std::string* {
+        if (index >= stringCache.size()) return nullptr;
+        if (!stringCached[index]) {
+            if (!blob.string(index, stringCache[index])) return nullptr;
+            stringCached[index] = 1;
+        }
+        return &stringCache[index];
+    };
+
+    const std::uint32_t chunkCount = blob.count(ChunkTable);
+    if (chunkCount == 0) {
+        if (!readPlatforms(blob, 0, platformCount, cachedString, outLevelData.platforms)) return false;
+        readDimensions(blob, 0, blob.count(DimensionTable), outLevelData.TexturesDimensions);
+    } else {
+        // streamed: only the chunk table comes out now, each chunk's platforms are read when it gets near the camera
+        const ChunkRecord* chunks = blob.array<ChunkRecord>(ChunkTable);
+        const std::uint32_t* chunkTextures = blob.array<std::uint32_t>(ChunkTextureTable);
+        outLevelData.chunks.resize(chunkCount);
+        for (std::uint32_t c = 0; c < chunkCount; ++c) {
+            const ChunkRecord& record = chunks[c];
+            if (!runFits(record.firstPlatform, record.platformCount, platformCount)
+                || !runFits(record.firstDimension, record.dimensionCount, blob.count(DimensionTable))
+                || !runFits(record.firstTexture, record.textureCount, blob.count(ChunkTextureTable))) {
+                std::cerr << "LevelBinary Error: Chunk " << c << " is corrupt." << std::endl;
+                return false;
+            }
+            LevelData::Chunk& chunk = outLevelData.chunks[c];
+            chunk.cell = {record.cellX, record.cellY};
+            chunk.bounds = sf::FloatRect({record.left, record.top}, {record.width, record.height});
+            chunk.platformCount = record.platformCount;
+            chunk.texturePaths.reserve(record.textureCount);
+            for (std::uint32_t t = record.firstTexture; t < record.firstTexture + record.textureCount; ++t) {
+                const std::string* texturePath = cachedString(chunkTextures[t]);
+                if (!texturePath) return false;
+                chunk.texturePaths.push_back(*texturePath);
+            }
+        }
+        outLevelData.chunkSize = header.chunkSize;
+    }
+
+    const MovingRecord* moving = blob.array<MovingRecord>(MovingTable);
+    outLevelData.movingPlatformDetails.reserve(blob.count(MovingTable));
+    for (std::uint32_t i = 0; i < blob.count(MovingTable); ++i) {
+        LevelData::MovingPlatformInfo info;
+        info.id = moving[i].id;
+        info.startPosition = {moving[i].startX, moving[i].startY};
+        info.axis = static_cast<char>(moving[i].axis);
+        info.distance = moving[i].distance;
+        info.cycleDuration = moving[i].cycleDuration;
+        info.initialDirection = moving[i].initialDirection;
+        outLevelData.movingPlatformDetails.push_back(info);
+    }
+
+    const InteractibleRecord* interactibles = blob.array<InteractibleRecord>(InteractibleTable);
+    outLevelData.interactiblePlatformDetails.reserve(blob.count(InteractibleTable));
+    for (std::uint32_t i = 0; i < blob.count(InteractibleTable); ++i) {
+        const std::string* interactionType = cachedString(interactibles[i].interactionType);
+        const std::string* targetBodyType = cachedString(interactibles[i].targetBodyType);
+        if (!interactionType || !targetBodyType) return false;
+        LevelData::InteractiblePlatformInfo info;
+        info.id = interactibles[i].id;
+        info.interactionType = *interactionType;
+        info.targetBodyTypeStr = *targetBodyType;
+        info.targetTileColor = unpackColor(interactibles[i].targetTileColor);
+        info.hasTargetTileColor = interactibles[i].hasTargetTileColor != 0;
+        info.oneTime = interactibles[i].oneTime != 0;
+        info.cooldown = interactibles[i].cooldown;
+        info.linkedID = interactibles[i].linkedID;
+        outLevelData.interactiblePlatformDetails.push_back(info);
+    }
+
+    const PortalRecord* portals = blob.array<PortalRecord>(PortalTable);
+    outLevelData.portalPlatformDetails.reserve(blob.count(PortalTable));
+    for (std::uint32_t i = 0; i < blob.count(PortalTable); ++i) {
+        LevelData::PortalPlatformInfo info;
+        info.id = portals[i].id;
+        info.portalID = portals[i].portalID;
+        info.offset = {portals[i].offsetX, portals[i].offsetY};
+        outLevelData.portalPlatformDetails.push_back(info);
+    }
+
+    const AnimationRecord* animations = blob.array<AnimationRecord>(AnimationTable);
+    const AnimationFrameRecord* animationFrames = blob.array<AnimationFrameRecord>(AnimationFrameTable);
+    const std::uint32_t frameCount = blob.count(AnimationFrameTable);
+    outLevelData.animationDetails.reserve(blob.count(AnimationTable));
+    for (std::uint32_t i = 0; i < blob.count(AnimationTable); ++i) {
+        const AnimationRecord& record = animations[i];
+        if (record.frameCount == 0 || record.firstFrame > frameCount || record.frameCount > frameCount - record.firstFrame
+            || record.loop > static_cast<std::uint8_t>(LevelData::AnimationLoop::PingPong)) {
+            std::cerr << "LevelBinary Error: Animation " << i << " is corrupt." << std::endl;
+            return false;
+        }
+        LevelData::AnimationInfo info;
+        info.id = record.id;
+        info.loop = static_cast<LevelData::AnimationLoop>(record.loop);
+        info.autoplay = record.autoplay != 0;
+        info.frames.reserve(record.frameCount);
+        info.durations.reserve(record.frameCount);
+        for (std::uint32_t f = record.firstFrame; f < record.firstFrame + record.frameCount; ++f) {
+            const AnimationFrameRecord& frame = animationFrames[f];
+            info.frames.emplace_back(sf::Vector2i{frame.left, frame.top}, sf::Vector2i{frame.width, frame.height});
+            info.durations.push_back(frame.duration);
+        }
+        outLevelData.animationDetails.push_back(std::move(info));
+    }
+
+    const std::uint32_t* textureTable = blob.array<std::uint32_t>(TextureTable);
+    outTexturePaths.reserve(blob.count(TextureTable));
+    for (std::uint32_t i = 0; i < blob.count(TextureTable); ++i) {
+        const std::string* texturePath = cachedString(textureTable[i]);
+        if (!texturePath) return false;
+        outTexturePaths.push_back(*texturePath);
+    }
+    return true;
+}
+
+bool LevelBinary::load(const std::string& path, LevelData& outLevelData, std::vector<std::string>& outTexturePaths) {
+    auto file = std::make_shared<LevelChunkFile>();
+    if (!file->open(path)) return false;
+    if (!read(file->data(), file->size(), outLevelData, outTexturePaths)) return false;
+    // a level loaded in one piece is done with the file, a streamed one still needs it for its chunks
+    if (!outLevelData.chunks.empty()) outLevelData.chunkFile = std::move(file);
+    return true;
+}
+
+bool LevelChunkFile::readChunk(std::size_t chunk, std::vector<phys::PlatformBody>& outPlatforms, std::map<int, sf::IntRect>& outDimensions) const {
+    outPlatforms.clear();
+    outDimensions.clear();
+    BlobReader blob(data(), size());
+    if (!data() || !blob.init() || !platformArraysAgree(blob) || chunk >= blob.count(LevelBinary::ChunkTable)) return false;
+
+    // same checks read() made, this only has the file to go on
+    const LevelBinary::ChunkRecord& record = blob.array<LevelBinary::ChunkRecord>(LevelBinary::ChunkTable)[chunk];
+    if (!runFits(record.firstPlatform, record.platformCount, blob.count(LevelBinary::PlatformId))
+        || !runFits(record.firstDimension, record.dimensionCount, blob.count(LevelBinary::DimensionTable))) {
+        return false;
+    }
+
+    std::unordered_map<std::uint32_t, std::string> strings;
+    auto cachedString = [&blob, &strings](std::uint32_t index) -> const std::string* {
+        auto it = strings.find(index);
+        if (it != strings.end()) return &it->second;
+        std::string value;
+        if (!blob.string(index, value)) return nullptr;
+        return &strings.emplace(index, std::move(value)).first->second;
+    };
+    if (!readPlatforms(blob, record.firstPlatform, record.platformCount, cachedString, outPlatforms)) return false;
+    readDimensions(blob, record.firstDimension, record.dimensionCount, outDimensions);
+    return true;
+}
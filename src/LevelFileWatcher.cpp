@@ -0,0 +1,108 @@
+#include "LevelFileWatcher.hpp"
+#include <algorithm>
+#include <iostream>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+LevelFileWatcher::~LevelFileWatcher() {
+    stop();
+}
+
+#ifdef __linux__
+
+bool LevelFileWatcher::watch(const std::string& directory) {
+    stop();
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0) {
+        std::cerr << "LevelFileWatcher Error: inotify_init1 failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    // editors either rewrite the file (close_write) or write a temp file and rename it over (moved_to)
+    if (inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "LevelFileWatcher Error: Could not watch " << directory << ": " << std::strerror(errno) << std::endl;
+        close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    m_directory = directory;
+    return true;
+}
+
+void LevelFileWatcher::stop() {
+    if (m_fd >= 0) close(m_fd); // closing drops the watch with it
+    m_fd = -1;
+    m_directory.clear();
+}
+
+std::vector<std::string> LevelFileWatcher::poll() {
+    std::vector<std::string> changed;
+    if (m_fd < 0) return changed;
+
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+        if (length <= 0) break; // EAGAIN, nothing more queued
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && !(event->mask & IN_ISDIR)) {
+                std::string name(event->name);
+                if (std::find(changed.begin(), changed.end(), name) == changed.end()) changed.push_back(std::move(name));
+            }
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+    return changed;
+}
+
+#else
+
+bool LevelFileWatcher::watch(const std::string& directory) {
+    stop();
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        std::cerr << "LevelFileWatcher Error: Could not watch " << directory << std::endl;
+        return false;
+    }
+    m_directory = directory;
+    scan(nullptr);
+    return true;
+}
+
+void LevelFileWatcher::stop() {
+    m_directory.clear();
+    m_writeTimes.clear();
+}
+
+void LevelFileWatcher::scan(std::vector<std::string>* changed) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+        if (!entry.is_regular_file(ec)) continue;
+        const auto writeTime = entry.last_write_time(ec);
+        if (ec) continue;
+        const std::string name = entry.path().filename().string();
+        auto it = m_writeTimes.find(name);
+        if (it == m_writeTimes.end()) {
+            m_writeTimes.emplace(name, writeTime);
+            if (changed) changed->push_back(name);
+        } else if (it->second != writeTime) {
+            it->second = writeTime;
+            if (changed) changed->push_back(name);
+        }
+    }
+    m_lastScan = std::chrono::steady_clock::now();
+}
+
+std::vector<std::string> LevelFileWatcher::poll() {
+    std::vector<std::string> changed;
+    if (m_directory.empty()) return changed;
+    if (std::chrono::steady_clock::now() - m_lastScan < std::chrono::milliseconds(500)) return changed;
+    scan(&changed);
+    return changed;
+}
+
+#endif
@@ -0,0 +1,516 @@
+#include "LevelJsonReader.hpp"
+#include "LevelManager.hpp"
+#include "SpriteManager.hpp"
+#include "rapidjson/reader.h"
+#include "rapidjson/error/en.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string_view>
+
+namespace {
+    // one json scalar, typed the way the dom would have typed it (IsUint/IsInt/IsNumber)
+    struct Scalar {
+        enum class Kind { Null, Bool, Int, Uint, Int64, Uint64, Double, String };
+        Kind kind = Kind::Null;
+        bool boolean = false;
+        std::int64_t integer = 0;
+        double real = 0.0;
+        std::string_view text;
+
+        bool isUint() const { return kind == Kind::Uint; }
+        bool isInt() const { return kind == Kind::Int || (kind == Kind::Uint && integer <= INT_MAX); }
+        bool isNumber() const { return kind != Kind::Null && kind != Kind::Bool && kind != Kind::String; }
+        bool isBool() const { return kind == Kind::Bool; }
+        bool isString() const { return kind == Kind::String; }
+        unsigned int asUint() const { return static_cast<unsigned int>(integer); }
+        int asInt() const { return static_cast<int>(integer); }
+        float asFloat() const { return static_cast<float>(real); }
+    };
+
+    // everything one platform object said, in whatever order it said it. turned into LevelData when the object closes
+    struct PlatformRecord {
+        bool hasId = false;
+        unsigned int id = 0;
+        sf::Vector2f position{0.f, 0.f};
+        bool hasSize = false;
+        float width = 50.f, height = 50.f;
+        sf::Vector2f surfaceVelocity{0.f, 0.f};
+        bool initiallyFalling = false;
+        bool hasType = false;
+        std::string type;
+        bool hasTexture = false;
+        std::string texture;
+
+        bool hasPortalID = false;
+        unsigned int portalID = 0;
+        bool hasTeleportOffset = false;
+        sf::Vector2f teleportOffset{10.f, 0.f};
+
+        bool hasMovement = false;
+        bool hasStartX = false, hasStartY = false;
+        sf::Vector2f movementStart{0.f, 0.f};
+        bool hasAxis = false;
+        std::string axis;
+        float distance = 0.f;
+        bool hasCycleDuration = false;
+        float cycleDuration = 4.f;
+        bool hasInitialDirection = false;
+        int initialDirection = 1;
+
+        bool hasInteraction = false;
+        LevelData::InteractiblePlatformInfo interaction;
+        bool hasTargetBodyType = false;
+        std::uint8_t tileColor[4] = {0, 0, 0, 255};
+
+        bool hasDimensions = false;
+        int dimensionFlags = 0; // one bit per corner coordinate that was an int
+        int dimensions[4] = {0, 0, 0, 0}; // top-left-x, top-left-y, bottom-right-x, bottom-right-y
+
+        bool hasAnimation = false;
+        LevelData::AnimationInfo animation;
+        bool hasLoop = false;
+        std::string loop;
+        float frameDuration = 0.1f;   // for frames that don't give their own
+        int frameFlags = 0;           // same corners as dimensions, for the frame being read
+        int frame[4] = {0, 0, 0, 0};
+        float duration = 0.f;         // 0 = frameDuration
+
+        void reset() { *this = PlatformRecord(); }
+    };
+
+    class LevelHandler {
+    public:
+        LevelHandler(LevelData& out, std::vector<std::string>& texturePaths, int expectedLevelNumber, const LevelJsonReader::BodyTypeLookup& bodyTypeLookup)
+            : m_out(out), m_texturePaths(texturePaths), m_expectedLevelNumber(expectedLevelNumber), m_bodyTypeLookup(bodyTypeLookup) {
+            m_contexts.reserve(16);
+        }
+
+        bool Null() { return value(Scalar()); }
+        bool Bool(bool b) { Scalar s; s.kind = Scalar::Kind::Bool; s.boolean = b; return value(s); }
+        bool Int(int i) { return value(number(Scalar::Kind::Int, i, i)); }
+        bool Uint(unsigned u) { return value(number(Scalar::Kind::Uint, u, u)); }
+        bool Int64(std::int64_t i) { return value(number(Scalar::Kind::Int64, i, static_cast<double>(i))); }
+        bool Uint64(std::uint64_t u) { return value(number(Scalar::Kind::Uint64, 0, static_cast<double>(u))); }
+        bool Double(double d) { return value(number(Scalar::Kind::Double, 0, d)); }
+        bool RawNumber(const char*, rapidjson::SizeType, bool) { return true; } // only with kParseNumbersAsStringsFlag, which we don't use
+        bool String(const char* str, rapidjson::SizeType length, bool) {
+            Scalar s;
+            s.kind = Scalar::Kind::String;
+            s.text = std::string_view(str, length);
+            return value(s);
+        }
+        bool Key(const char* str, rapidjson::SizeType length, bool) {
+            m_key = std::string_view(str, length);
+            return true;
+        }
+
+        bool StartObject() {
+            const Context parent = m_contexts.empty() ? Context::None : m_contexts.back();
+            Context next = Context::Skip;
+            if (parent == Context::None) next = Context::Root;
+            else if (parent == Context::Root && m_key == "playerStart") { next = Context::PlayerStart; m_hasPlayerStart = true; }
+            else if (parent == Context::Root && m_key == "backgroundColor") { next = Context::BackgroundColor; m_hasBackgroundColor = true; }
+            else if (parent == Context::Platforms) { next = Context::Platform; m_platform.reset(); }
+            else if (parent == Context::Platform) {
+                if (m_key == "position") next = Context::Position;
+                else if (m_key == "size") { next = Context::Size; m_platform.hasSize = true; }
+                else if (m_key == "surfaceVelocity") next = Context::SurfaceVelocity;
+                else if (m_key == "teleportOffset") { next = Context::TeleportOffset; m_platform.hasTeleportOffset = true; }
+                else if (m_key == "movement") { next = Context::Movement; m_platform.hasMovement = true; }
+                else if (m_key == "interaction") { next = Context::Interaction; m_platform.hasInteraction = true; }
+                else if (m_key == "dimensions") { next = Context::Dimensions; m_platform.hasDimensions = true; }
+                else if (m_key == "animation") { next = Context::Animation; m_platform.hasAnimation = true; }
+            }
+            else if (parent == Context::AnimationFrames) {
+                next = Context::AnimationFrame;
+                m_platform.frameFlags = 0;
+                m_platform.duration = 0.f;
+            }
+            else if (parent == Context::Movement && m_key == "startPosition") next = Context::MovementStart;
+            else if (parent == Context::Interaction && m_key == "targetTileColor") { next = Context::TargetTileColor; m_platform.interaction.hasTargetTileColor = true; }
+            m_contexts.push_back(next);
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType) {
+            const Context closing = m_contexts.back();
+            m_contexts.pop_back();
+            if (closing == Context::Platform) finishPlatform();
+            else if (closing == Context::AnimationFrame) finishFrame();
+            return true;
+        }
+
+        bool StartArray() {
+            const Context parent = m_contexts.empty() ? Context::None : m_contexts.back();
+            if (parent == Context::Root && m_key == "platforms") {
+                m_hasPlatforms = true;
+                m_contexts.push_back(Context::Platforms);
+            } else if (parent == Context::Animation && m_key == "frames") {
+                m_contexts.push_back(Context::AnimationFrames);
+            } else {
+                m_contexts.push_back(Context::Skip);
+            }
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType) {
+            m_contexts.pop_back();
+            return true;
+        }
+
+        // the root-level checks the dom version did up front, now that everything has been seen
+        bool finish() {
+            if (!m_hasLevelName) {
+                m_out.levelName = "Unnamed Level";
+                std::cerr << "LevelManager Parse Warning: 'levelName' missing or not string." << std::endl;
+            }
+            if (!m_hasLevelNumber) std::cerr << "LevelManager Parse Warning: 'levelNumber' missing or not an int." << std::endl;
+            if (!m_hasPlayerStart) {
+                std::cerr << "LevelManager Parse Warning: 'playerStart' missing or not object." << std::endl;
+                m_out.playerStartPosition = {100.f, 100.f};
+            } else {
+                if (!m_hasPlayerStartX) std::cerr << "LevelManager Parse Warning: playerStart.x missing/not number." << std::endl;
+                if (!m_hasPlayerStartY) std::cerr << "LevelManager Parse Warning: playerStart.y missing/not number." << std::endl;
+            }
+            if (m_hasBackgroundColor) {
+                m_out.backgroundColor = sf::Color(m_backgroundColor[0], m_backgroundColor[1], m_backgroundColor[2], m_backgroundColor[3]);
+            } else {
+                std::cerr << "LevelManager Parse Warning: 'backgroundColor' missing. Using default." << std::endl;
+                m_out.backgroundColor = sf::Color(20, 20, 40);
+            }
+            if (!m_hasPlatforms) {
+                std::cerr << "LevelManager Error: Missing platforms array\n";
+                return false;
+            }
+
+            m_texturePaths.push_back(DEFAULT_TEXTURE_FILEPATH);
+            std::sort(m_texturePaths.begin(), m_texturePaths.end());
+            m_texturePaths.erase(std::unique(m_texturePaths.begin(), m_texturePaths.end()), m_texturePaths.end());
+            return true;
+        }
+
+    private:
+        enum class Context {
+            None, Root, PlayerStart, BackgroundColor, Platforms, Platform, Position, Size, SurfaceVelocity,
+            TeleportOffset, Movement, MovementStart, Interaction, TargetTileColor, Dimensions, Animation, AnimationFrames,
+            AnimationFrame, Skip
+        };
+
+        static Scalar number(Scalar::Kind kind, std::int64_t integer, double real) {
+            Scalar s;
+            s.kind = kind;
+            s.integer = integer;
+            s.real = real;
+            return s;
+        }
+
+        static bool colorChannel(std::string_view key, const Scalar& v, std::uint8_t (&rgba)[4]) {
+            if (!v.isUint()) return false;
+            const char channels[4] = {'r', 'g', 'b', 'a'};
+            for (int i = 0; i < 4; ++i) {
+                if (key.size() == 1 && key[0] == channels[i]) {
+                    rgba[i] = static_cast<std::uint8_t>(v.asUint());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool value(const Scalar& v) {
+            if (m_contexts.empty()) return true;
+            PlatformRecord& p = m_platform;
+            switch (m_contexts.back()) {
+                case Context::Root:
+                    if (m_key == "levelName" && v.isString()) {
+                        m_out.levelName.assign(v.text);
+                        m_hasLevelName = true;
+                    } else if (m_key == "levelNumber" && v.isInt()) {
+                        if (v.asInt() != m_expectedLevelNumber && m_expectedLevelNumber != 0) {
+                            std::cerr << "LevelManager Parse Warning: JSON levelNumber (" << v.asInt()
+                                      << ") mismatches target load (" << m_expectedLevelNumber << ")." << std::endl;
+                        }
+                        m_out.levelNumber = v.asInt();
+                        m_hasLevelNumber = true;
+                    } else if (m_key == "backgroundTexture" && v.isString()) {
+                        std::string path(v.text);
+                        if (path.find(IMAGE_DIRECTORY) == std::string::npos) path = IMAGE_DIRECTORY + path;
+                        m_out.backgroundTexturePath = path;
+                        m_texturePaths.push_back(std::move(path));
+                    }
+                    break;
+                case Context::PlayerStart:
+                    if (m_key == "x" && v.isNumber()) { m_out.playerStartPosition.x = v.asFloat(); m_hasPlayerStartX = true; }
+                    else if (m_key == "y" && v.isNumber()) { m_out.playerStartPosition.y = v.asFloat(); m_hasPlayerStartY = true; }
+                    break;
+                case Context::BackgroundColor:
+                    colorChannel(m_key, v, m_backgroundColor);
+                    break;
+                case Context::Platform:
+                    if (m_key == "id" && v.isUint()) { p.hasId = true; p.id = v.asUint(); }
+                    else if (m_key == "type" && v.isString()) { p.hasType = true; p.type.assign(v.text); }
+                    else if (m_key == "texture" && v.isString()) { p.hasTexture = true; p.texture.assign(v.text); }
+                    else if (m_key == "initiallyFalling" && v.isBool()) p.initiallyFalling = v.boolean;
+                    else if (m_key == "portalID" && v.isUint()) { p.hasPortalID = true; p.portalID = v.asUint(); }
+                    break;
+                case Context::Position:
+                    if (m_key == "x" && v.isNumber()) p.position.x = v.asFloat();
+                    else if (m_key == "y" && v.isNumber()) p.position.y = v.asFloat();
+                    break;
+                case Context::Size:
+                    if (m_key == "width" && v.isNumber()) p.width = v.asFloat();
+                    else if (m_key == "height" && v.isNumber()) p.height = v.asFloat();
+                    break;
+                case Context::SurfaceVelocity:
+                    if (m_key == "x" && v.isNumber()) p.surfaceVelocity.x = v.asFloat();
+                    else if (m_key == "y" && v.isNumber()) p.surfaceVelocity.y = v.asFloat();
+                    break;
+                case Context::TeleportOffset:
+                    if (m_key == "x" && v.isNumber()) p.teleportOffset.x = v.asFloat();
+                    else if (m_key == "y" && v.isNumber()) p.teleportOffset.y = v.asFloat();
+                    break;
+                case Context::Movement:
+                    if (m_key == "axis" && v.isString()) { p.hasAxis = true; p.axis.assign(v.text); }
+                    else if (m_key == "distance" && v.isNumber()) p.distance = v.asFloat();
+                    else if (m_key == "cycleDuration" && v.isNumber()) { p.hasCycleDuration = true; p.cycleDuration = v.asFloat(); }
+                    else if (m_key == "initialDirection" && v.isInt()) { p.hasInitialDirection = true; p.initialDirection = v.asInt(); }
+                    break;
+                case Context::MovementStart:
+                    if (m_key == "x" && v.isNumber()) { p.hasStartX = true; p.movementStart.x = v.asFloat(); }
+                    else if (m_key == "y" && v.isNumber()) { p.hasStartY = true; p.movementStart.y = v.asFloat(); }
+                    break;
+                case Context::Interaction:
+                    if (m_key == "type" && v.isString()) p.interaction.interactionType.assign(v.text);
+                    else if (m_key == "targetBodyType" && v.isString()) { p.hasTargetBodyType = true; p.interaction.targetBodyTypeStr.assign(v.text); }
+                    else if (m_key == "oneTime" && v.isBool()) p.interaction.oneTime = v.boolean;
+                    else if (m_key == "cooldown" && v.isNumber()) p.interaction.cooldown = v.asFloat();
+                    else if (m_key == "linkedID" && v.isUint()) p.interaction.linkedID = v.asUint();
+                    break;
+                case Context::TargetTileColor:
+                    colorChannel(m_key, v, p.tileColor);
+                    break;
+                case Context::Dimensions: {
+                    static constexpr std::string_view corners[4] = {"top-left-x", "top-left-y", "bottom-right-x", "bottom-right-y"};
+                    for (int i = 0; i < 4; ++i) {
+                        if (m_key == corners[i] && v.isInt()) {
+                            p.dimensions[i] = v.asInt();
+                            p.dimensionFlags |= 1 << i;
+                        }
+                    }
+                    break;
+                }
+                case Context::Animation:
+                    if (m_key == "loop" && v.isString()) { p.hasLoop = true; p.loop.assign(v.text); }
+                    else if (m_key == "autoplay" && v.isBool()) p.animation.autoplay = v.boolean;
+                    else if (m_key == "frameDuration" && v.isNumber()) p.frameDuration = v.asFloat();
+                    break;
+                case Context::AnimationFrame: {
+                    static constexpr std::string_view corners[4] = {"top-left-x", "top-left-y", "bottom-right-x", "bottom-right-y"};
+                    for (int i = 0; i < 4; ++i) {
+                        if (m_key == corners[i] && v.isInt()) {
+                            p.frame[i] = v.asInt();
+                            p.frameFlags |= 1 << i;
+                        }
+                    }
+                    if (m_key == "duration" && v.isNumber()) p.duration = v.asFloat();
+                    break;
+                }
+                default:
+                    break;
+            }
+            return true;
+        }
+
+        // one entry of an animation's frames array, written like a dimensions block plus an optional duration
+        void finishFrame() {
+            PlatformRecord& p = m_platform;
+            if (p.frameFlags != 0xF) {
+                std::cerr << "LevelManager Parse Warning: Animation frame " << p.animation.frames.size() << " of platform "
+                          << (p.hasId ? std::to_string(p.id) : std::string("?")) << " is missing a corner, skipped." << std::endl;
+                return;
+            }
+            p.animation.frames.emplace_back(sf::Vector2i{p.frame[0], p.frame[1]}, sf::Vector2i{p.frame[2] - p.frame[0], p.frame[3] - p.frame[1]});
+            p.animation.durations.push_back(p.duration);
+        }
+
+        void finishPlatform() {
+            PlatformRecord& p = m_platform;
+            unsigned int id = p.id;
+            if (!p.hasId) {
+                id = static_cast<unsigned int>(m_out.platforms.size() + 1000);
+                std::cerr << "Auto-assigned ID: " << id << " to missing ID platform\n";
+            }
+            if (!p.hasSize) std::cerr << "Platform ID " << id << " missing size, using defaults.\n";
+
+            const phys::bodyType type = p.hasType ? m_bodyTypeLookup(p.type) : phys::bodyType::solid;
+
+            // texture load list and source rects come out of the same pass now
+            if (p.hasTexture) {
+                std::string path = p.texture;
+                if (path.find(TEXTURE_DIRECTORY) == std::string::npos) path = TEXTURE_DIRECTORY + path;
+                m_texturePaths.push_back(std::move(path));
+            }
+            if (p.hasDimensions && p.hasId && p.id != 0 && p.dimensionFlags == 0xF) {
+                m_out.TexturesDimensions.emplace(p.id, sf::IntRect({p.dimensions[0], p.dimensions[1]},
+                                                                   {p.dimensions[2] - p.dimensions[0], p.dimensions[3] - p.dimensions[1]}));
+            }
+
+            if (p.hasAnimation && !p.animation.frames.empty()) {
+                LevelData::AnimationInfo animation = std::move(p.animation);
+                animation.id = id;
+                if (p.hasLoop) {
+                    if (p.loop == "loop") animation.loop = LevelData::AnimationLoop::Loop;
+                    else if (p.loop == "pingpong") animation.loop = LevelData::AnimationLoop::PingPong;
+                    else if (p.loop != "once") std::cerr << "Warning: Unknown animation loop '" << p.loop << "' for platform " << id << ". Playing once." << std::endl;
+                }
+                if (p.frameDuration <= 0.f) {
+                    std::cerr << "Warning: Non-positive frameDuration for platform " << id << ". Defaulting to 0.1s." << std::endl;
+                    p.frameDuration = 0.1f;
+                }
+                for (float& duration : animation.durations) {
+                    if (duration <= 0.f) duration = p.frameDuration;
+                }
+                m_out.animationDetails.push_back(std::move(animation));
+            }
+
+            m_out.platforms.emplace_back(id, p.position, p.width, p.height, type, p.initiallyFalling, p.surfaceVelocity,
+                                         p.hasTexture ? p.texture : std::string(DEFAULT_TEXTURE_FILEPATH));
+            phys::PlatformBody& justAddedBody = m_out.platforms.back();
+
+            if (type == phys::bodyType::portal) {
+                if (!p.hasPortalID) {
+                    std::cerr << "Portal missing portalID, ID: " << id << "\n";
+                    return;
+                }
+                LevelData::PortalPlatformInfo ppi;
+                ppi.id = id;
+                ppi.portalID = p.portalID;
+                ppi.offset = p.teleportOffset;
+                justAddedBody.setPortalID(ppi.portalID);
+                justAddedBody.setTeleportOffset(ppi.offset);
+                m_out.portalPlatformDetails.push_back(ppi);
+            }
+            else if (type == phys::bodyType::moving && p.hasMovement) {
+                LevelData::MovingPlatformInfo mpi;
+                mpi.id = id;
+                mpi.startPosition = p.position;
+                if (p.hasStartX) mpi.startPosition.x = p.movementStart.x;
+                if (p.hasStartY) mpi.startPosition.y = p.movementStart.y;
+                if (p.hasAxis) {
+                    if (!p.axis.empty()) mpi.axis = static_cast<char>(std::tolower(static_cast<unsigned char>(p.axis[0])));
+                    else std::cerr << "Warning: Moving platform ID " << id << " has empty axis." << std::endl;
+                }
+                mpi.distance = p.distance;
+                if (p.hasCycleDuration) {
+                    mpi.cycleDuration = p.cycleDuration;
+                    if (mpi.cycleDuration <= 0.f) {
+                        std::cerr << "Warning: Non-positive cycleDuration for moving platform " << id << ". Defaulting to 4s." << std::endl;
+                        mpi.cycleDuration = 4.f;
+                    }
+                }
+                if (p.hasInitialDirection) {
+                    mpi.initialDirection = p.initialDirection;
+                    if (mpi.initialDirection != 1 && mpi.initialDirection != -1) {
+                        std::cerr << "Warning: Invalid initialDirection for moving platform " << id << ". Defaulting to 1." << std::endl;
+                        mpi.initialDirection = 1;
+                    }
+                }
+                m_out.movingPlatformDetails.push_back(mpi);
+            }
+            else if (type == phys::bodyType::interactible && p.hasInteraction) {
+                LevelData::InteractiblePlatformInfo ipi = p.interaction;
+                ipi.id = id;
+                if (!p.hasTargetBodyType) {
+                    std::cerr << "LevelManager Parse Error: Interactible platform ID " << id << " 'interaction' block missing 'targetBodyType' string. Defaulting to 'solid'." << std::endl;
+                    ipi.targetBodyTypeStr = "solid";
+                }
+                if (ipi.hasTargetTileColor) ipi.targetTileColor = sf::Color(p.tileColor[0], p.tileColor[1], p.tileColor[2], p.tileColor[3]);
+                m_out.interactiblePlatformDetails.push_back(ipi);
+            }
+        }
+
+        LevelData& m_out;
+        std::vector<std::string>& m_texturePaths;
+        int m_expectedLevelNumber;
+        const LevelJsonReader::BodyTypeLookup& m_bodyTypeLookup;
+
+        std::vector<Context> m_contexts;
+        std::string_view m_key; // points into the in-situ buffer, good until the next key
+        PlatformRecord m_platform;
+
+        bool m_hasLevelName = false;
+        bool m_hasLevelNumber = false;
+        bool m_hasPlayerStart = false;
+        bool m_hasPlayerStartX = false;
+        bool m_hasPlayerStartY = false;
+        bool m_hasBackgroundColor = false;
+        std::uint8_t m_backgroundColor[4] = {20, 20, 40, 255};
+        bool m_hasPlatforms = false;
+    };
+}
+
+LevelJsonReader::LevelJsonReader(BodyTypeLookup bodyTypeLookup)
+    : m_bodyTypeLookup(std::move(bodyTypeLookup)), m_arena(16 * 1024) {}
+
+bool LevelJsonReader::read(const std::string& filename, LevelData& outLevelData, std::vector<std::string>& outTexturePaths, int expectedLevelNumber,
+                           Stats* outStats) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto start = std::chrono::steady_clock::now();
+
+    FILE* fp = fopen(filename.c_str(), "rb");
+    if (!fp) {
+        std::cerr << "LevelManager Error: Could not open JSON file: " << filename << std::endl;
+        return false;
+    }
+    std::fseek(fp, 0, SEEK_END);
+    const long fileSize = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+    if (fileSize < 0) {
+        fclose(fp);
+        std::cerr << "LevelManager Error: Could not size JSON file: " << filename << std::endl;
+        return false;
+    }
+    // resize keeps the capacity from the last level, so after the first load this is just the read
+    m_buffer.resize(static_cast<std::size_t>(fileSize) + 1);
+    const std::size_t bytesRead = std::fread(m_buffer.data(), 1, static_cast<std::size_t>(fileSize), fp);
+    fclose(fp);
+    m_buffer[bytesRead] = '\0';
+    const auto parseStart = std::chrono::steady_clock::now();
+
+    outLevelData.platforms.clear();
+    outLevelData.movingPlatformDetails.clear();
+    outLevelData.interactiblePlatformDetails.clear();
+    outLevelData.portalPlatformDetails.clear();
+    outLevelData.TexturesList.clear();
+    outLevelData.TexturesDimensions.clear();
+    outLevelData.animationDetails.clear();
+    outLevelData.backgroundTexturePath.clear();
+    outLevelData.chunks.clear();
+    outLevelData.chunkSize = 0.f;
+    outLevelData.chunkFile.reset();
+    outTexturePaths.clear();
+
+    LevelHandler handler(outLevelData, outTexturePaths, expectedLevelNumber, m_bodyTypeLookup);
+    rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>> reader(&m_arena);
+    rapidjson::InsituStringStream stream(m_buffer.data());
+    const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+    m_arena.Clear();
+    if (result.IsError()) {
+        std::cerr << "LevelManager Error parsing JSON: " << filename << std::endl;
+        std::cerr << "Error (offset " << result.Offset() << "): " << rapidjson::GetParseError_En(result.Code()) << std::endl;
+        return false;
+    }
+    if (!handler.finish()) return false;
+
+    if (outStats) {
+        const auto end = std::chrono::steady_clock::now();
+        outStats->bytes = bytesRead;
+        outStats->readMs = std::chrono::duration<double, std::milli>(parseStart - start).count();
+        outStats->parseMs = std::chrono::duration<double, std::milli>(end - parseStart).count();
+    }
+    return true;
+}
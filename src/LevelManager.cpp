@@ -1,11 +1,11 @@
 #include "LevelManager.hpp"
 #include "SpriteManager.hpp"
-#include "rapidjson/filereadstream.h"
-#include "rapidjson/error/en.h"
-#include <cstdio>
+#include "LevelBinary.hpp"
 #include <iostream>
 #include <algorithm>
 #include <set>
+#include <chrono>
+#include <filesystem>
 
 // Constructor
 LevelManager::LevelManager()
@@ -21,8 +21,14 @@ LevelManager::LevelManager()
       m_generalLoadingScreenPath("../assets/images/Loading-screen.png"),
       m_nextLevelLoadingScreenPath("../assets/images/Loading-screen.jpeg"),
       m_respawnLoadingScreenPath("../assets/images/respawn.png"), 
-      m_loadingJsonDoc(nullptr), 
-      m_textureLoadIndex(0){
+      m_textureLoadIndex(0),
+      m_textureUploadBudgetMs(4.f),
+      m_levelParseMs(0.0),
+      m_uploadFrames(0),
+      m_prefetchLevelNumber(0),
+      m_prefetchByteBudget(64u * 1024u * 1024u),
+      m_waitingForPrefetch(false),
+      m_jsonReader([this](const std::string& typeStr) { return stringToBodyType(typeStr); }) {
 
     m_bodyTypeMap["none"] = phys::bodyType::none;
     m_bodyTypeMap["platform"] = phys::bodyType::platform;
@@ -40,7 +46,7 @@ LevelManager::LevelManager()
     m_fadeOverlay.setFillColor(sf::Color(0, 0, 0, 0));
 }
 
-LevelManager::~LevelManager() {freeJsonDocument(m_loadingJsonDoc);} //close mid load
+LevelManager::~LevelManager() {dropPrefetch();} // the prefetch job reads our members, let it finish first
 void LevelManager::setGeneralLoadingScreenImage(const std::string& imagePath) {
     m_generalLoadingScreenPath = imagePath;
 }
@@ -65,6 +71,11 @@ bool LevelManager::requestLoadLevel(int levelNumber, LevelData& outLevelData, Lo
              return false;
         }
     }
+    // a respawn comes back to the same next level, anything else that isn't the prefetched level makes it useless
+    // (dropping waits out at most the image the job is decoding right now)
+    if (m_prefetch.valid() && m_prefetchLevelNumber != levelNumber && type != LoadRequestType::RESPAWN) {
+        dropPrefetch();
+    }
     m_targetLevelNumber = levelNumber;
     m_levelDataToFill = &outLevelData;
     m_currentLoadType = type;
@@ -118,9 +129,10 @@ void LevelManager::update(float dt, sf::RenderWindow& window, bool isFullscreen)
                     default:                          imageToLoadPath = m_generalLoadingScreenPath; break;
                 }
                 if (!imageToLoadPath.empty()) {
-                    if (m_loadingTexture.loadFromFile(imageToLoadPath)) {
-                        m_loadingTexture.setSmooth(true);
-                        m_loadingSprite.emplace(m_loadingTexture);
+                    m_loadingTexture = m_textureCache.acquire(imageToLoadPath);
+                    if (m_loadingTexture) {
+                        m_loadingTexture->setSmooth(true);
+                        m_loadingSprite.emplace(*m_loadingTexture);
                         // resize to fit window
 
                         if (imageToLoadPath == m_generalLoadingScreenPath)
@@ -159,29 +171,28 @@ void LevelManager::update(float dt, sf::RenderWindow& window, bool isFullscreen)
                 }
                 
                 // clean
-                freeJsonDocument(m_loadingJsonDoc);
-                m_loadingJsonDoc = nullptr;
                 m_texturePathsToLoad.clear();
+                m_pendingDecodes.clear(); // anything still decoding for an aborted load just gets dropped
+                m_cachedTextures.clear();
+                m_loadStartTime = std::chrono::steady_clock::now();
+                m_textureLoadIndex = 0; //load textured in indecise
+                m_uploadFrames = 0;
 
-                std::string filename = m_levelBasePath + "level" + std::to_string(m_targetLevelNumber) + ".json";
-                m_loadingJsonDoc = readJsonFile(filename);
-
-                if (!m_loadingJsonDoc) {
-                    std::cerr << "LevelManager Error: Failed to read/parse " << filename << ". Aborting load." << std::endl;
-                    m_transitionState = TransitionState::NONE; m_levelDataToFill = nullptr;
+                // next level already read in the background, processLoadingTick swaps it in once the job is done
+                if (m_prefetch.valid() && m_prefetchLevelNumber == m_targetLevelNumber) {
+                    m_waitingForPrefetch = true;
+                    std::cout << "LevelManager: Using prefetched level " << m_targetLevelNumber << "." << std::endl;
                     break;
                 }
 
-                // Parse everything except the texture files which increases effificneyc
-                if (!parseLevelData(*m_loadingJsonDoc, *m_levelDataToFill) || !prepareAsynchronousLoad(*m_loadingJsonDoc, *m_levelDataToFill)) {
+                if (!readLevel(m_targetLevelNumber, *m_levelDataToFill, m_texturePathsToLoad)) {
                     std::cerr << "LevelManager Error: Failed to prepare level " << m_targetLevelNumber << " for loading." << std::endl;
-                    freeJsonDocument(m_loadingJsonDoc); m_loadingJsonDoc = nullptr;
                     m_transitionState = TransitionState::NONE; m_levelDataToFill = nullptr;
                     break;
                 }
-
-                m_textureLoadIndex = 0; //load textured in indecise
-                std::cout << "LevelManager: Ready to load " << m_texturePathsToLoad.size() << " textures asynchronously." << std::endl;
+                m_levelParseMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_loadStartTime).count();
+                startTextureDecodes();
+                std::cout << "LevelManager: Decoding " << m_texturePathsToLoad.size() << " textures on " << m_decodePool.getWorkerCount() << " workers." << std::endl;
             }
             break;
         }
@@ -204,9 +215,11 @@ void LevelManager::update(float dt, sf::RenderWindow& window, bool isFullscreen)
                 m_levelDataToFill = nullptr;
                 m_loadingScreenReady = false;
                 m_texturePathsToLoad.clear();
-                freeJsonDocument(m_loadingJsonDoc); //final checks
-                m_loadingJsonDoc = nullptr;
+                m_pendingDecodes.clear();
                 std::cout << "LevelManager: FADING_IN complete. Transition finished." << std::endl;
+                if (m_currentLevelNumber > 0 && hasNextLevel()) {
+                    startPrefetch(m_currentLevelNumber + 1);
+                }
             }
             break;
         }
@@ -233,35 +246,138 @@ bool LevelManager::isTransitioning() const {
     return m_transitionState != TransitionState::NONE;
 }
 
-bool LevelManager::hasNextLevel() const {
-    if (m_maxLevels > 0) {
-        return m_currentLevelNumber < m_maxLevels;
+void LevelManager::setHotReloadEnabled(bool enabled) {
+    if (!enabled) {
+        m_levelWatcher.stop();
+        return;
     }
-    return true;
+    if (m_levelWatcher.isWatching()) return;
+    if (m_levelWatcher.watch(m_levelBasePath)) std::cout << "LevelManager: Hot reload watching " << m_levelBasePath << std::endl;
 }
 
-bool LevelManager::performActualLoad(int levelNumber, LevelData& outLevelData) {
-    std::string filename = m_levelBasePath + "level" + std::to_string(levelNumber) + ".json";
-    std::cout << "LevelManager: Performing actual load of: " << filename << std::endl;
-    return loadLevelDataFromFile(filename, outLevelData);
+namespace {
+    bool sameMoving(const LevelData::MovingPlatformInfo& a, const LevelData::MovingPlatformInfo& b) {
+        return a.id == b.id && a.startPosition == b.startPosition && a.axis == b.axis && a.distance == b.distance
+            && a.cycleDuration == b.cycleDuration && a.initialDirection == b.initialDirection;
+    }
+    bool sameInteractible(const LevelData::InteractiblePlatformInfo& a, const LevelData::InteractiblePlatformInfo& b) {
+        return a.id == b.id && a.interactionType == b.interactionType && a.targetBodyTypeStr == b.targetBodyTypeStr
+            && a.targetTileColor == b.targetTileColor && a.hasTargetTileColor == b.hasTargetTileColor && a.oneTime == b.oneTime
+            && a.cooldown == b.cooldown && a.linkedID == b.linkedID;
+    }
+    bool samePortal(const LevelData::PortalPlatformInfo& a, const LevelData::PortalPlatformInfo& b) {
+        return a.id == b.id && a.portalID == b.portalID && a.offset == b.offset;
+    }
+    bool sameAnimation(const LevelData::AnimationInfo& a, const LevelData::AnimationInfo& b) {
+        return a.id == b.id && a.loop == b.loop && a.autoplay == b.autoplay && a.frames == b.frames && a.durations == b.durations;
+    }
+    template <typename T, typename Same>
+    bool sameList(const std::vector<T>& a, const std::vector<T>& b, Same same) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), same);
+    }
+
+    bool samePlatform(const phys::PlatformBody& a, const phys::PlatformBody& b) {
+        return a.getPosition() == b.getPosition() && a.getWidth() == b.getWidth() && a.getHeight() == b.getHeight()
+            && a.getType() == b.getType() && a.isFalling() == b.isFalling() && a.getSurfaceVelocity() == b.getSurfaceVelocity()
+            && a.getTexturePath() == b.getTexturePath();
+    }
+
+    // these carry per-level state (movement cycle, interaction timers, portal pairs) that an in-place swap can't patch
+    bool hasSideTables(phys::bodyType type) {
+        return type == phys::bodyType::moving || type == phys::bodyType::interactible || type == phys::bodyType::portal;
+    }
+
+    // old and new template of the same level, by platform id. the live level was built from the old one
+    void diffLevels(const LevelData& oldData, const LevelData& newData, LevelReload& out) {
+        out.structural = false;
+        out.changedPlatforms.clear();
+        if (oldData.platforms.size() != newData.platforms.size()
+            || !sameList(oldData.movingPlatformDetails, newData.movingPlatformDetails, sameMoving)
+            || !sameList(oldData.interactiblePlatformDetails, newData.interactiblePlatformDetails, sameInteractible)
+            || !sameList(oldData.portalPlatformDetails, newData.portalPlatformDetails, samePortal)
+            || !sameList(oldData.animationDetails, newData.animationDetails, sameAnimation)) {
+            out.structural = true;
+            return;
+        }
+        for (std::size_t i = 0; i < newData.platforms.size(); ++i) {
+            const phys::PlatformBody& before = oldData.platforms[i];
+            const phys::PlatformBody& after = newData.platforms[i];
+            if (before.getID() != after.getID()) {
+                out.structural = true;
+                return;
+            }
+            const auto oldRect = oldData.TexturesDimensions.find(after.getID());
+            const auto newRect = newData.TexturesDimensions.find(after.getID());
+            const bool sameRect = (oldRect == oldData.TexturesDimensions.end()) == (newRect == newData.TexturesDimensions.end())
+                               && (oldRect == oldData.TexturesDimensions.end() || oldRect->second == newRect->second);
+            if (samePlatform(before, after) && sameRect) continue;
+            if (hasSideTables(before.getType()) || hasSideTables(after.getType())) {
+                out.structural = true;
+                return;
+            }
+            out.changedPlatforms.push_back(i);
+        }
+    }
 }
 
-bool LevelManager::loadLevelDataFromFile(const std::string& filename, LevelData& outLevelData) {
-    std::cout << "LevelManager (internal): Reading JSON from: " << filename << std::endl;
-    rapidjson::Document* doc = readJsonFile(filename);
-    if (!doc) {
-        std::cerr << "LevelManager: Failed to read/parse " << filename << std::endl;
+bool LevelManager::pollHotReload(LevelData& liveLevelData, LevelReload& outReload) {
+    if (!m_levelWatcher.isWatching()) return false;
+    const std::vector<std::string> changedFiles = m_levelWatcher.poll();
+    if (changedFiles.empty() || isTransitioning() || m_currentLevelNumber <= 0) return false;
+
+    const std::string currentFile = "level" + std::to_string(m_currentLevelNumber) + ".json";
+    const std::string prefetchFile = "level" + std::to_string(m_prefetchLevelNumber) + ".json";
+    bool currentChanged = false;
+    for (const std::string& name : changedFiles) {
+        if (name == currentFile) currentChanged = true;
+        // whatever the prefetch read is outdated now, read it again
+        if (m_prefetch.valid() && name == prefetchFile) {
+            const int levelNumber = m_prefetchLevelNumber;
+            dropPrefetch();
+            startPrefetch(levelNumber);
+        }
+    }
+    if (!currentChanged) return false;
+
+    const auto start = std::chrono::steady_clock::now();
+    LevelData newData;
+    std::vector<std::string> texturePaths;
+    if (!m_jsonReader.read(m_levelBasePath + currentFile, newData, texturePaths, m_currentLevelNumber)) {
+        std::cerr << "LevelManager: Hot reload of " << currentFile << " failed, keeping the level as it is." << std::endl;
         return false;
     }
-    bool parseSuccess = parseLevelData(*doc, outLevelData);
-    freeJsonDocument(doc);
-    if (parseSuccess) {
-        outLevelData.levelNumber = m_targetLevelNumber;
-        std::cout << "LevelManager (internal): Successfully parsed data from " << filename << std::endl;
-    } else {
-        std::cerr << "LevelManager (internal): Failed to parse level data structure from " << filename << std::endl;
+    diffLevels(liveLevelData, newData, outReload);
+
+    // textures the level already has stay, only paths the edit introduced get loaded. the background is left for the next load
+    newData.TexturesList = std::move(liveLevelData.TexturesList);
+    newData.atlas = std::move(liveLevelData.atlas);
+    // a streamed level gets rebuilt from its chunks, the streamer loads whatever textures they need
+    if (m_streamer.partition(newData)) {
+        outReload.structural = true;
+        texturePaths.clear();
+    }
+    for (const std::string& path : texturePaths) {
+        if (path == newData.backgroundTexturePath || newData.TexturesList.count(path)) continue;
+        if (std::shared_ptr<sf::Texture> texture = m_textureCache.acquire(path)) {
+            newData.TexturesList.emplace(path, std::move(texture));
+        } else if (!newData.TexturesList.count(DEFAULT_TEXTURE_FILEPATH)) {
+            if (std::shared_ptr<sf::Texture> fallback = m_textureCache.acquire(DEFAULT_TEXTURE_FILEPATH)) newData.TexturesList.emplace(DEFAULT_TEXTURE_FILEPATH, std::move(fallback));
+        }
     }
-    return parseSuccess;
+    liveLevelData = std::move(newData);
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "LevelManager: Hot reloaded " << currentFile << " in " << ms << " ms, ";
+    if (outReload.structural) std::cout << "layout changed, rebuilding the level" << std::endl;
+    else std::cout << outReload.changedPlatforms.size() << " platform(s) changed in place" << std::endl;
+    return true;
+}
+
+bool LevelManager::hasNextLevel() const {
+    if (m_maxLevels > 0) {
+        return m_currentLevelNumber < m_maxLevels;
+    }
+    return true;
 }
 
 // MADE PUBLIC and CONST
@@ -274,357 +390,344 @@ phys::bodyType LevelManager::stringToBodyType(const std::string& typeStr) const
     return phys::bodyType::solid;
 }
 
-rapidjson::Document* LevelManager::readJsonFile(const std::string& filepath) {
-    FILE* fp = fopen(filepath.c_str(), "rb");
-    if (!fp) {
-        std::cerr << "LevelManager Error: Could not open JSON file: " << filepath << std::endl;
-        return nullptr;
-    }
-    char readBuffer[65536];
-    rapidjson::FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-    rapidjson::Document* d = new rapidjson::Document();
-    d->ParseStream(is);
-    fclose(fp);
-    if (d->HasParseError()) {
-        std::cerr << "LevelManager Error parsing JSON: " << filepath << std::endl;
-        std::cerr << "Error (offset " << d->GetErrorOffset() << "): "
-                  << rapidjson::GetParseError_En(d->GetParseError()) << std::endl;
-        delete d;
-        return nullptr;
-    }
-    return d;
+bool LevelManager::loadLevelFromJson(const std::string& filename, LevelData& outLevelData, std::vector<std::string>& outTexturePaths) {
+    return m_jsonReader.read(filename, outLevelData, outTexturePaths, 0);
 }
 
-void LevelManager::freeJsonDocument(rapidjson::Document* doc) {
-    if (doc) {
-        delete doc;
+bool LevelManager::compileLevel(const std::string& jsonFilename, const std::string& binaryFilename) {
+    LevelData levelData;
+    std::vector<std::string> texturePaths;
+    if (!loadLevelFromJson(jsonFilename, levelData, texturePaths)) {
+        std::cerr << "LevelManager Error: Could not compile " << jsonFilename << std::endl;
+        return false;
     }
+    // a level big enough to stream is stored chunk by chunk, so the game can read one chunk at a time
+    m_streamer.partition(levelData);
+    return LevelBinary::write(binaryFilename, levelData, texturePaths);
 }
 
-bool LevelManager::parseLevelData(const rapidjson::Document& d, LevelData& outLevelData) {
-    int jsonLevelNum = 0;
-
-    outLevelData.platforms.clear();
-    outLevelData.movingPlatformDetails.clear();
-    outLevelData.interactiblePlatformDetails.clear();
-    outLevelData.portalPlatformDetails.clear();  
-    if (d.HasMember("levelName") && d["levelName"].IsString()) {
-        outLevelData.levelName = d["levelName"].GetString();
+bool LevelManager::readLevel(int levelNumber, LevelData& outLevelData, std::vector<std::string>& outTexturePaths, LoadProfile* outProfile) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::string levelStem = m_levelBasePath + "level" + std::to_string(levelNumber);
+    const std::string filename = levelStem + ".json";
+
+    if (tryLoadCompiledLevel(levelStem + ".bin", filename, levelNumber, outLevelData, outTexturePaths)) {
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "LevelManager: Level " << levelNumber << " read from " << levelStem << ".bin in " << ms << " ms" << std::endl;
+        if (outProfile) {
+            std::error_code ec;
+            outProfile->fromBinary = true;
+            outProfile->fileBytes = static_cast<std::size_t>(std::filesystem::file_size(levelStem + ".bin", ec));
+            outProfile->parseMs = ms;
+        }
     } else {
-        outLevelData.levelName = "Unnamed Level";
-         std::cerr << "LevelManager Parse Warning: 'levelName' missing or not string." << std::endl;
+        // Parse everything except the texture files which increases effificneyc
+        LevelJsonReader::Stats parseStats;
+        if (!m_jsonReader.read(filename, outLevelData, outTexturePaths, levelNumber, &parseStats)) {
+            std::cerr << "LevelManager Error: Failed to read/parse " << filename << ". Aborting load." << std::endl;
+            return false;
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "LevelManager: Level " << levelNumber << " parsed from " << filename << " in " << ms << " ms ("
+                  << parseStats.bytes << " bytes, read " << parseStats.readMs << " ms, parse " << parseStats.parseMs << " ms, "
+                  << parseStats.megabytesPerSecond() << " MB/s)" << std::endl;
+        if (outProfile) {
+            outProfile->fromBinary = false;
+            outProfile->fileBytes = parseStats.bytes;
+            outProfile->readMs = parseStats.readMs;
+            outProfile->parseMs = parseStats.parseMs;
+        }
     }
 
-    if (d.HasMember("levelNumber") && d["levelNumber"].IsInt()) {
-           jsonLevelNum = d["levelNumber"].GetInt();
-           if (jsonLevelNum != m_targetLevelNumber && m_targetLevelNumber !=0 ) {
-               std::cerr << "LevelManager Parse Warning: JSON levelNumber (" << jsonLevelNum
-                         << ") mismatches target load (" << m_targetLevelNumber << ")." << std::endl;
-           }
-        outLevelData.levelNumber = d["levelNumber"].GetInt();
-    } else {
-        std::cerr << "LevelManager Parse Warning: 'levelNumber' missing or not an int." << std::endl;
+    // huge levels: the loading screen only waits for the textures around the start, the streamer brings in the rest
+    const auto chunkStart = std::chrono::steady_clock::now();
+    const bool streamed = m_streamer.partition(outLevelData);
+    if (outProfile) outProfile->chunkMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - chunkStart).count();
+    if (streamed) {
+        const std::size_t allTextures = outTexturePaths.size();
+        m_streamer.filterTexturePaths(outLevelData, outLevelData.playerStartPosition, outTexturePaths);
+        std::cout << "LevelManager: Level " << levelNumber << " is streamed, loading " << outTexturePaths.size() << " of "
+                  << allTextures << " textures up front" << std::endl;
+        if (!outLevelData.chunkFile) {
+            std::cout << "LevelManager: Level " << levelNumber << " came from json, all of its chunks stay in memory. Run levelc "
+                      << "to stream them from the compiled level instead." << std::endl;
+        }
     }
+    return true;
+}
 
-    if (d.HasMember("playerStart") && d["playerStart"].IsObject()) {
-        const auto& ps = d["playerStart"];
-        if (ps.HasMember("x") && ps["x"].IsNumber()) outLevelData.playerStartPosition.x = ps["x"].GetFloat();
-        else std::cerr << "LevelManager Parse Warning: playerStart.x missing/not number." << std::endl;
-        if (ps.HasMember("y") && ps["y"].IsNumber()) outLevelData.playerStartPosition.y = ps["y"].GetFloat();
-        else std::cerr << "LevelManager Parse Warning: playerStart.y missing/not number." << std::endl;
-    } else {
-        std::cerr << "LevelManager Parse Warning: 'playerStart' missing or not object." << std::endl;
-        outLevelData.playerStartPosition = {100.f, 100.f};
-    }
-
-    if (d.HasMember("backgroundColor") && d["backgroundColor"].IsObject()) {
-        const auto& bc = d["backgroundColor"];
-        uint8_t r = 20, g_json = 20, b_json = 40, a_json = 255; 
-        if (bc.HasMember("r") && bc["r"].IsUint()) r = bc["r"].GetUint();
-        if (bc.HasMember("g") && bc["g"].IsUint()) g_json = bc["g"].GetUint();
-        if (bc.HasMember("b") && bc["b"].IsUint()) b_json = bc["b"].GetUint();
-        if (bc.HasMember("a") && bc["a"].IsUint()) a_json = bc["a"].GetUint();
-        outLevelData.backgroundColor = sf::Color(r, g_json, b_json, a_json);
-    } else {
-        std::cerr << "LevelManager Parse Warning: 'backgroundColor' missing. Using default." << std::endl;
-         outLevelData.backgroundColor = sf::Color(20, 20, 40);
+bool LevelManager::loadLevelNow(int levelNumber, LevelData& outLevelData, LoadProfile* outProfile, bool uploadTextures) {
+    using Clock = std::chrono::steady_clock;
+    auto msSince = [](Clock::time_point from) { return std::chrono::duration<double, std::milli>(Clock::now() - from).count(); };
+    const auto start = Clock::now();
+    LoadProfile profile;
+    std::vector<std::string> texturePaths;
+    outLevelData.TexturesList.clear();
+    outLevelData.atlas.reset();
+    if (!readLevel(levelNumber, outLevelData, texturePaths, &profile)) return false;
+    profile.texturesLoaded = texturePaths.size();
+
+    // same split as a transition: everything decodes on the pool at once, uploads go in list order afterwards
+    auto phaseStart = Clock::now();
+    std::vector<std::shared_ptr<sf::Texture>> cached(texturePaths.size());
+    std::vector<std::future<DecodedImage>> decodes;
+    decodes.reserve(texturePaths.size());
+    for (std::size_t i = 0; i < texturePaths.size(); ++i) {
+        if (uploadTextures) cached[i] = m_textureCache.find(texturePaths[i]);
+        decodes.push_back(cached[i] ? readyDecode(DecodedImage()) : queueDecode(texturePaths[i]));
     }
-    if (d.HasMember("platforms") && d["platforms"].IsArray()) {
-        const auto& platformsArray = d["platforms"];
-        outLevelData.platforms.reserve(platformsArray.Size());
-
-        for (rapidjson::SizeType i = 0; i < platformsArray.Size(); ++i) {
-            const auto& platJson = platformsArray[i];
-            if (!platJson.IsObject()) continue;
-
-            // Parse Common Properties
-            unsigned int id = 0;
-            if (platJson.HasMember("id") && platJson["id"].IsUint()) {
-                id = platJson["id"].GetUint();
-            } else {
-                id = static_cast<unsigned int>(outLevelData.platforms.size() + 1000);
-                std::cerr << "Auto-assigned ID: " << id << " to missing ID platform\n";
-            }
-            // Parse Position
-            sf::Vector2f pos{0, 0};
-            if (platJson.HasMember("position") && platJson["position"].IsObject()) {
-                const auto& posJson = platJson["position"];
-                pos.x = posJson.HasMember("x") ? posJson["x"].GetFloat() : 0;
-                pos.y = posJson.HasMember("y") ? posJson["y"].GetFloat() : 0;
-            }
-
-            // Parse Size 
-            float width = 50.f, height = 50.f; // Default values if not specified
-            if (platJson.HasMember("size") && platJson["size"].IsObject()) {
-                const auto& sizeJson = platJson["size"];
-                width = sizeJson.HasMember("width") ? sizeJson["width"].GetFloat() : width;
-                height = sizeJson.HasMember("height") ? sizeJson["height"].GetFloat() : height;
-            } else { std::cerr << "Platform ID " << id << " missing size, using defaults.\n"; } // Added warning for missing size
-
-            sf::Vector2f surfaceVel = {0.f, 0.f};
-            if (platJson.HasMember("surfaceVelocity") && platJson["surfaceVelocity"].IsObject()) {
-                const auto& sv = platJson["surfaceVelocity"];
-                if (sv.HasMember("x") && sv["x"].IsNumber()) surfaceVel.x = sv["x"].GetFloat();
-                if (sv.HasMember("y") && sv["y"].IsNumber()) surfaceVel.y = sv["y"].GetFloat();
-            }
-
-            bool initiallyFalling = false;
-            if (platJson.HasMember("initiallyFalling") && platJson["initiallyFalling"].IsBool()) {
-               initiallyFalling = platJson["initiallyFalling"].GetBool();
-            }
-
-            // Parse Body Type
-            phys::bodyType type = phys::bodyType::solid; 
-            if (platJson.HasMember("type") && platJson["type"].IsString()) {
-                type = stringToBodyType(platJson["type"].GetString());
-            }
-
-            // Parse individual texture (path)
-            std::string texturePath = DEFAULT_TEXTURE_FILEPATH;
-            if (platJson.HasMember("texture") && platJson["texture"].IsString()){
-                texturePath = platJson["texture"].GetString();
-            }
-
-            // Create Base Platform
-            outLevelData.platforms.emplace_back(
-                id, pos, width, height, type, initiallyFalling, surfaceVel, texturePath //checkpoint
-            );
-            
-            phys::PlatformBody& justAddedBody = outLevelData.platforms.back();
-
-            // Handle Special Types
-            if (type == phys::bodyType::portal) {
-                LevelData::PortalPlatformInfo ppi;
-                ppi.id = id;
-
-                // Parse PortalID (Required)
-                if (platJson.HasMember("portalID") && platJson["portalID"].IsUint()) {
-                    ppi.portalID = platJson["portalID"].GetUint();
-                } else {
-                    std::cerr << "Portal missing portalID, ID: " << id << "\n";
-                    ppi.portalID = 0;
-                    continue;
-                }
-
-                // Parse Teleport Offset (Optional)
-                if (platJson.HasMember("teleportOffset") && platJson["teleportOffset"].IsObject()) {
-                    const auto& offsetJson = platJson["teleportOffset"];
-                    ppi.offset.x = offsetJson.HasMember("x") && offsetJson["x"].IsNumber() ? offsetJson["x"].GetFloat() : 10.f;
-                    ppi.offset.y = offsetJson.HasMember("y") && offsetJson["y"].IsNumber() ? offsetJson["y"].GetFloat() : 0.f;
-                } else {
-                     ppi.offset = {10.f, 0.f}; 
-                }
-                justAddedBody.setPortalID(ppi.portalID);
-                justAddedBody.setTeleportOffset(ppi.offset);
+    std::vector<DecodedImage> images(texturePaths.size());
+    for (std::size_t i = 0; i < texturePaths.size(); ++i) {
+        images[i] = decodes[i].get();
+        if (cached[i]) ++profile.cacheHits;
+        if (!images[i].loaded) continue;
+        ++profile.texturesDecoded;
+        profile.decodedBytes += std::size_t(images[i].image.getSize().x) * images[i].image.getSize().y * 4;
+    }
+    profile.decodeMs = msSince(phaseStart);
 
-                outLevelData.portalPlatformDetails.push_back(ppi);
-            }
+    if (uploadTextures) {
+        phaseStart = Clock::now();
+        for (std::size_t i = 0; i < texturePaths.size(); ++i) addLevelTexture(outLevelData, texturePaths[i], std::move(cached[i]), images[i]);
+        profile.uploadMs = msSince(phaseStart);
 
-            else if (type == phys::bodyType::moving && platJson.HasMember("movement") && platJson["movement"].IsObject()) {
-                const auto& mov = platJson["movement"];
-                LevelData::MovingPlatformInfo mpi;
-                mpi.id = id;
-                mpi.startPosition = pos; // Use the platform's general 'pos' as default start, override if specified in 'movement'
-                if (mov.HasMember("startPosition") && mov["startPosition"].IsObject()) { 
-                    const auto& msp = mov["startPosition"];
-                    if (msp.HasMember("x") && msp["x"].IsNumber()) mpi.startPosition.x = msp["x"].GetFloat();
-                    if (msp.HasMember("y") && msp["y"].IsNumber()) mpi.startPosition.y = msp["y"].GetFloat();
-                }
-                if (mov.HasMember("axis") && mov["axis"].IsString()) {
-                    std::string axisStr = mov["axis"].GetString();
-                    if (!axisStr.empty()) mpi.axis = std::tolower(axisStr[0]);
-                    else std::cerr << "Warning: Moving platform ID " << id << " has empty axis." << std::endl;
-                }
-                if (mov.HasMember("distance") && mov["distance"].IsNumber()) {
-                    mpi.distance = mov["distance"].GetFloat();
-                }
-                if (mov.HasMember("cycleDuration") && mov["cycleDuration"].IsNumber()) {
-                    mpi.cycleDuration = mov["cycleDuration"].GetFloat();
-                     if (mpi.cycleDuration <= 0.f) {
-                        std::cerr << "Warning: Non-positive cycleDuration for moving platform " << id << ". Defaulting to 4s." << std::endl;
-                        mpi.cycleDuration = 4.f;
-                     }
-                }
-                 if (mov.HasMember("initialDirection") && mov["initialDirection"].IsInt()) {
-                    mpi.initialDirection = mov["initialDirection"].GetInt();
-                    if(mpi.initialDirection != 1 && mpi.initialDirection != -1) {
-                        std::cerr << "Warning: Invalid initialDirection for moving platform " << id << ". Defaulting to 1." << std::endl;
-                        mpi.initialDirection = 1;
-                    }
-                }
-                outLevelData.movingPlatformDetails.push_back(mpi);
-            }
-            // PARSE INTERACTIBLE DETAILS
-            else if (type == phys::bodyType::interactible && platJson.HasMember("interaction") && platJson["interaction"].IsObject()) {
-                const auto& inter = platJson["interaction"];
-                LevelData::InteractiblePlatformInfo ipi;
-                ipi.id = id;
-
-                if (inter.HasMember("type") && inter["type"].IsString()) {
-                    ipi.interactionType = inter["type"].GetString();
-                }
-                if (inter.HasMember("targetBodyType") && inter["targetBodyType"].IsString()) {
-                    ipi.targetBodyTypeStr = inter["targetBodyType"].GetString();
-                } else {
-                    std::cerr << "LevelManager Parse Error: Interactible platform ID " << id << " 'interaction' block missing 'targetBodyType' string. Defaulting to 'solid'." << std::endl;
-                    ipi.targetBodyTypeStr = "solid"; 
-                }
-
-                if (inter.HasMember("targetTileColor") && inter["targetTileColor"].IsObject()) {
-                    const auto& tc = inter["targetTileColor"];
-                    uint8_t r_tc = 0, g_tc = 0, b_tc = 0, a_tc = 255;
-                    if (tc.HasMember("r") && tc["r"].IsUint()) r_tc = tc["r"].GetUint();
-                    if (tc.HasMember("g") && tc["g"].IsUint()) g_tc = tc["g"].GetUint();
-                    if (tc.HasMember("b") && tc["b"].IsUint()) b_tc = tc["b"].GetUint();
-                    if (tc.HasMember("a") && tc["a"].IsUint()) a_tc = tc["a"].GetUint();
-                    ipi.targetTileColor = sf::Color(r_tc, g_tc, b_tc, a_tc);
-                    ipi.hasTargetTileColor = true;
-                }
+        phaseStart = Clock::now();
+        buildLevelAtlas(outLevelData);
+        profile.atlasMs = msSince(phaseStart);
+    }
+    profile.totalMs = msSince(start);
+    if (outProfile) *outProfile = profile;
+    return true;
+}
 
-                if (inter.HasMember("oneTime") && inter["oneTime"].IsBool()) {
-                    ipi.oneTime = inter["oneTime"].GetBool();
-                }
-                if (inter.HasMember("cooldown") && inter["cooldown"].IsNumber()) {
-                    ipi.cooldown = inter["cooldown"].GetFloat();
-                }
-                 if (inter.HasMember("linkedID") && inter["linkedID"].IsUint()) { // Added linkedID parsing
-                    ipi.linkedID = inter["linkedID"].GetUint();
-                }
-                outLevelData.interactiblePlatformDetails.push_back(ipi); // Ensure this is added for interactibles
-            
-            }
-        } 
+bool LevelManager::tryLoadCompiledLevel(const std::string& binaryFilename, const std::string& jsonFilename, int expectedLevelNumber,
+                                        LevelData& outLevelData, std::vector<std::string>& outTexturePaths) {
+    std::error_code ec;
+    if (!std::filesystem::exists(binaryFilename, ec)) return false;
+
+    // json is still what gets edited, an older blob would silently load the previous version of the level
+    const auto binaryTime = std::filesystem::last_write_time(binaryFilename, ec);
+    if (!ec) {
+        std::error_code jsonEc;
+        const auto jsonTime = std::filesystem::last_write_time(jsonFilename, jsonEc);
+        if (!jsonEc && jsonTime > binaryTime) {
+            std::cout << "LevelManager: " << binaryFilename << " is older than " << jsonFilename << ", using the json. Rerun levelc." << std::endl;
+            return false;
+        }
+    }
 
-    } else {
-        std::cerr << "LevelManager Error: Missing platforms array\n";
+    outLevelData.TexturesList.clear();
+    if (!LevelBinary::load(binaryFilename, outLevelData, outTexturePaths)) {
+        std::cerr << "LevelManager Warning: Could not use " << binaryFilename << ", falling back to json." << std::endl;
+        outTexturePaths.clear();
         return false;
     }
+    if (outLevelData.levelNumber != expectedLevelNumber && expectedLevelNumber != 0) {
+        std::cerr << "LevelManager Parse Warning: binary levelNumber (" << outLevelData.levelNumber
+                  << ") mismatches target load (" << expectedLevelNumber << ")." << std::endl;
+    }
+    return true;
+}
 
-    return true; //remove unecessary debug
+std::future<LevelManager::DecodedImage> LevelManager::queueDecode(const std::string& path) {
+    // image decoding doesn't touch the gl context, so any thread can do it
+    return m_decodePool.submit([path]() {
+        DecodedImage decoded;
+        decoded.loaded = decoded.image.loadFromFile(path);
+        return decoded;
+    });
 }
 
-bool LevelManager::prepareAsynchronousLoad(const rapidjson::Document& d, LevelData& outLevelData) {
-    // clear ram
-    outLevelData.TexturesList.clear();
-    outLevelData.TexturesDimensions.clear();
-    m_texturePathsToLoad.clear();
+std::future<LevelManager::DecodedImage> LevelManager::readyDecode(DecodedImage&& decoded) {
+    std::promise<DecodedImage> ready;
+    ready.set_value(std::move(decoded));
+    return ready.get_future();
+}
 
+void LevelManager::addLevelTexture(LevelData& levelData, const std::string& path_to_load, std::shared_ptr<sf::Texture> texture,
+                                   const DecodedImage& decoded) {
+    // handle background case
+    std::string key_to_use = path_to_load;
+    if (!levelData.backgroundTexturePath.empty() && path_to_load == levelData.backgroundTexturePath) {
+        key_to_use = LEVEL_BG_ID; // Use the special identifier for the background
+    }
 
-    std::set<std::string> uniquePaths;
-    uniquePaths.insert(DEFAULT_TEXTURE_FILEPATH);
+    if (!texture) {
+        sf::Texture newTexture;
+        if (decoded.loaded && newTexture.loadFromImage(decoded.image)) {
+            texture = m_textureCache.insert(path_to_load, std::move(newTexture));
+        }
+    }
+    if (!texture) {
+        std::cerr << "LevelManager Error: Failed to load texture '" << path_to_load << "'. Using default." << std::endl;
+        texture = m_textureCache.acquire(DEFAULT_TEXTURE_FILEPATH); // Use fallback
+        key_to_use = DEFAULT_TEXTURE_FILEPATH; // enuse matches
+    }
 
+    // store in lvl data
+    if (texture && levelData.TexturesList.find(key_to_use) == levelData.TexturesList.end()) {
+        levelData.TexturesList.emplace(key_to_use, std::move(texture));
+    }
+}
 
-    if (d.HasMember("platforms") && d["platforms"].IsArray()) {
-        const auto& platformsArray = d["platforms"];
-        for (rapidjson::SizeType i = 0; i < platformsArray.Size(); ++i) {
-            const auto& platJson = platformsArray[i];
-            if (!platJson.IsObject()) continue;
+void LevelManager::startTextureDecodes() {
+    m_pendingDecodes.clear();
+    m_cachedTextures.assign(m_texturePathsToLoad.size(), nullptr);
+    m_pendingDecodes.reserve(m_texturePathsToLoad.size());
+    for (std::size_t i = 0; i < m_texturePathsToLoad.size(); ++i) {
+        // still cached from an earlier level, nothing to decode. holding it here also keeps it from being evicted mid-load
+        m_cachedTextures[i] = m_textureCache.find(m_texturePathsToLoad[i]);
+        m_pendingDecodes.push_back(m_cachedTextures[i] ? readyDecode(DecodedImage()) : queueDecode(m_texturePathsToLoad[i]));
+    }
+}
 
-            // Collect list
-            if (platJson.HasMember("texture") && platJson["texture"].IsString()) {
-                std::string path = platJson["texture"].GetString();
-                
-                if (path.find(TEXTURE_DIRECTORY) == std::string::npos)
-                    path = TEXTURE_DIRECTORY + path;
-                uniquePaths.insert(path);
-            }
+void LevelManager::buildLevelAtlas(LevelData& levelData) {
+    std::vector<TextureAtlas::Source> sources;
+    sources.reserve(levelData.TexturesList.size());
+    for (const auto& [key, texture] : levelData.TexturesList) {
+        if (key == LEVEL_BG_ID) continue; // drawn on its own, full screen
+        sources.push_back(TextureAtlas::Source{key, texture.get()});
+    }
 
-            // We scan and parse at the same time
-            if (platJson.HasMember("dimensions") && platJson["dimensions"].IsObject()) {
-                const auto& dimensions = platJson["dimensions"];
-                unsigned int id = 0;
-                if (platJson.HasMember("id") && platJson["id"].IsUint()) {
-                    id = platJson["id"].GetUint();
-                }
+    // a new atlas every load, the old one stays alive for as long as the old tiles point into it
+    levelData.atlas = std::make_shared<TextureAtlas>();
+    if (!levelData.atlas->build(sources)) {
+        levelData.atlas.reset();
+        return;
+    }
+    const TextureAtlas::Stats& stats = levelData.atlas->getStats();
+    std::cout << "LevelManager: Atlas packed " << stats.packed << " textures into " << stats.pages << " page(s) in " << stats.packMs
+              << " ms, " << static_cast<int>(stats.occupancy() * 100.f) << "% occupied, " << stats.skipped << " too big to pack" << std::endl;
+}
 
-                if (id != 0 && dimensions.HasMember("top-left-x") && dimensions["top-left-x"].IsInt()
-                    && dimensions.HasMember("top-left-y") && dimensions["top-left-y"].IsInt()
-                    && dimensions.HasMember("bottom-right-x") && dimensions["bottom-right-x"].IsInt()
-                    && dimensions.HasMember("bottom-right-y") && dimensions["bottom-right-y"].IsInt())
-                    {
-                        outLevelData.TexturesDimensions.emplace(id,
-                            sf::IntRect({dimensions["top-left-x"].GetInt(), dimensions["top-left-y"].GetInt()},
-                                {dimensions["bottom-right-x"].GetInt() - dimensions["top-left-x"].GetInt(),
-                                dimensions["bottom-right-y"].GetInt() - dimensions["top-left-y"].GetInt()}));
-                    }
+void LevelManager::startPrefetch(int levelNumber) {
+    if (m_prefetch.valid() && m_prefetchLevelNumber == levelNumber) return;
+    dropPrefetch();
+
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    const std::size_t byteBudget = m_prefetchByteBudget;
+    m_prefetchCancel = cancel;
+    m_prefetchLevelNumber = levelNumber;
+    m_prefetch = m_decodePool.submit([this, levelNumber, byteBudget, cancel]() {
+        const auto start = std::chrono::steady_clock::now();
+        auto level = std::make_shared<PrefetchedLevel>();
+        level->ok = readLevel(levelNumber, level->data, level->texturePaths);
+        if (!level->ok) return level;
+
+        // one image at a time on this one worker, the game is running and nobody is waiting on it
+        level->images.resize(level->texturePaths.size());
+        for (std::size_t i = 0; i < level->texturePaths.size() && !cancel->load(); ++i) {
+            if (m_textureCache.contains(level->texturePaths[i])) continue; // shared with a level we already have
+            DecodedImage& decoded = level->images[i];
+            decoded.loaded = decoded.image.loadFromFile(level->texturePaths[i]);
+            const std::size_t bytes = std::size_t(decoded.image.getSize().x) * decoded.image.getSize().y * 4;
+            if (!decoded.loaded || level->imageBytes + bytes > byteBudget) {
+                decoded = DecodedImage(); // decoded again (or failed again) at transition time
+                continue;
             }
+            level->imageBytes += bytes;
         }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "LevelManager: Prefetched level " << levelNumber << " (" << level->imageBytes / 1024 << " KB of images) in " << ms << " ms" << std::endl;
+        return level;
+    });
+}
+
+void LevelManager::dropPrefetch() {
+    if (m_prefetchCancel) m_prefetchCancel->store(true);
+    if (m_prefetch.valid()) m_prefetch.wait();
+    m_prefetch = {};
+    m_prefetchCancel.reset();
+    m_prefetchLevelNumber = 0;
+    m_waitingForPrefetch = false;
+}
+
+bool LevelManager::adoptPrefetch() {
+    std::shared_ptr<PrefetchedLevel> level = m_prefetch.get();
+    m_prefetch = {};
+    m_prefetchCancel.reset();
+    m_prefetchLevelNumber = 0;
+    m_waitingForPrefetch = false;
+
+    if (!level || !level->ok) {
+        std::cerr << "LevelManager Warning: Prefetch of level " << m_targetLevelNumber << " failed, loading it now." << std::endl;
+        if (!readLevel(m_targetLevelNumber, *m_levelDataToFill, m_texturePathsToLoad)) return false;
+        m_levelParseMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_loadStartTime).count();
+        startTextureDecodes();
+        return true;
     }
 
-    // Also check for the special level background texture (wgat?)
-    if (d.HasMember("backgroundTexture") && d["backgroundTexture"].IsString()) {
-        std::string path = d["backgroundTexture"].GetString();
-        if (path.find(IMAGE_DIRECTORY) == std::string::npos) {
-            path = IMAGE_DIRECTORY + path;
+    // the old level's textures get released here, on the main thread
+    *m_levelDataToFill = std::move(level->data);
+    m_texturePathsToLoad = std::move(level->texturePaths);
+    m_levelParseMs = 0.0;
+
+    // cached textures and already decoded images become ready futures, the rest go to the pool like a normal load
+    m_pendingDecodes.clear();
+    m_cachedTextures.assign(m_texturePathsToLoad.size(), nullptr);
+    m_pendingDecodes.reserve(m_texturePathsToLoad.size());
+    for (std::size_t i = 0; i < m_texturePathsToLoad.size(); ++i) {
+        m_cachedTextures[i] = m_textureCache.find(m_texturePathsToLoad[i]);
+        if (m_cachedTextures[i]) {
+            m_pendingDecodes.push_back(readyDecode(DecodedImage()));
+        } else if (i < level->images.size() && level->images[i].loaded) {
+            m_pendingDecodes.push_back(readyDecode(std::move(level->images[i])));
+        } else {
+            m_pendingDecodes.push_back(queueDecode(m_texturePathsToLoad[i]));
         }
-        uniquePaths.insert(path);
     }
-
-    // Now copy the unique paths into our texture loading list
-    m_texturePathsToLoad.assign(uniquePaths.begin(), uniquePaths.end());
-
     return true;
 }
 
 void LevelManager::processLoadingTick() {
-    // check if finished loading texture
-    if (m_textureLoadIndex >= m_texturePathsToLoad.size()) {
-        std::cout << "LevelManager: Asynchronous loading complete." << std::endl;
-        m_currentLevelNumber = m_targetLevelNumber;
-
-        // fade in now
-        m_transitionState = TransitionState::FADING_IN;
-        m_transitionClock.restart();
-        return; // exit
+    if (m_waitingForPrefetch) {
+        if (m_prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return; // almost there, keep the loading screen up
+        if (!adoptPrefetch()) {
+            std::cerr << "LevelManager Error: Failed to prepare level " << m_targetLevelNumber << " for loading." << std::endl;
+            m_transitionState = TransitionState::NONE; m_levelDataToFill = nullptr;
+            return;
+        }
     }
 
-    // keep load texture path
-    const std::string& path_to_load = m_texturePathsToLoad[m_textureLoadIndex];
+    const auto tickStart = std::chrono::steady_clock::now();
+    ++m_uploadFrames;
 
-    // handle background case
-    std::string key_to_use = path_to_load;
-    if (m_loadingJsonDoc->HasMember("backgroundTexture") && (*m_loadingJsonDoc)["backgroundTexture"].IsString()) {
-        std::string bg_path_json = (*m_loadingJsonDoc)["backgroundTexture"].GetString();
-        std::string bg_path_full = (bg_path_json.find(IMAGE_DIRECTORY) == std::string::npos) ? (IMAGE_DIRECTORY + bg_path_json) : bg_path_json;
+    // upload in list order so the default texture fallback resolves the same way every time
+    // at least one texture per frame, then keep going while the budget lasts
+    while (m_textureLoadIndex < m_pendingDecodes.size()) {
+        std::future<DecodedImage>& pending = m_pendingDecodes[m_textureLoadIndex];
+        if (pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) break; // still decoding, keep the loading screen up
+        DecodedImage decoded = pending.get();
 
-        if (path_to_load == bg_path_full) {
-            key_to_use = LEVEL_BG_ID; // Use the special identifier for the background
-        }
-    }
+        const std::string& path_to_load = m_texturePathsToLoad[m_textureLoadIndex];
 
-    sf::Texture newTexture;
-    std::cout << "Loading texture: " << path_to_load << "..." << std::endl;
-    if (!newTexture.loadFromFile(path_to_load)) {
-        std::cerr << "LevelManager Error: Failed to load texture '" << path_to_load << "'. Using default." << std::endl;
-        newTexture.loadFromFile(DEFAULT_TEXTURE_FILEPATH); // Use fallback
-        key_to_use = DEFAULT_TEXTURE_FILEPATH; // enuse matches
-    }
+        addLevelTexture(*m_levelDataToFill, path_to_load, std::move(m_cachedTextures[m_textureLoadIndex]), decoded);
 
-    // store in lvl data
-    if (m_levelDataToFill && m_levelDataToFill->TexturesList.find(key_to_use) == m_levelDataToFill->TexturesList.end()) {
-        m_levelDataToFill->TexturesList.emplace(key_to_use, std::move(newTexture));
+        // advance to next texture
+        m_textureLoadIndex++;
+
+        const double spentMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tickStart).count();
+        if (spentMs >= m_textureUploadBudgetMs) break;
     }
 
-    // advance to next texture
-    m_textureLoadIndex++;
-}
\ No newline at end of file
+    // check if finished loading texture
+    if (m_textureLoadIndex >= m_texturePathsToLoad.size()) {
+        const double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_loadStartTime).count();
+        std::cout << "LevelManager: Level " << m_targetLevelNumber << " loaded in " << totalMs << " ms (level data "
+                  << m_levelParseMs << " ms, " << m_texturePathsToLoad.size() << " textures over " << m_uploadFrames << " frames)" << std::endl;
+        m_currentLevelNumber = m_targetLevelNumber;
+        m_pendingDecodes.clear();
+        m_cachedTextures.clear();
+        buildLevelAtlas(*m_levelDataToFill);
+
+        // the previous level's textures lost their last holder when this one replaced them, make room now if needed
+        m_textureCache.trim();
+        const TextureCache::Stats stats = m_textureCache.getStats();
+        std::cout << "LevelManager: Texture cache " << stats.entries << " textures, " << stats.bytes / (1024 * 1024) << " MB, "
+                  << stats.hits << " hits / " << stats.misses << " misses, " << stats.evictions << " evicted" << std::endl;
+
+        // fade in now
+        m_transitionState = TransitionState::FADING_IN;
+        m_transitionClock.restart();
+    }
+}
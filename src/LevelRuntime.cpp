@@ -0,0 +1,135 @@
+#include "LevelRuntime.hpp"
+#include "PhysicsTypes.hpp"
+#include <algorithm>
+
+void LevelRuntime::clear() {
+    m_denseIds.clear();
+    m_sparseIds.clear();
+    m_moving.clear();
+    m_falling.clear();
+    m_vanishing.clear();
+    m_interactible.clear();
+    m_fallingOrVanishing.clear();
+    m_freeBodies.clear();
+}
+
+void LevelRuntime::build(const std::vector<phys::PlatformBody>& platformBodies) {
+    clear();
+
+    // level ids are hand numbered so they're small, but don't let one id of 4000000000 allocate 32 GB
+    const std::size_t denseLimit = platformBodies.size() * 4 + 1024;
+    m_denseIds.assign(denseLimit, NoIndex);
+
+    for (std::size_t i = 0; i < platformBodies.size(); ++i) {
+        const phys::PlatformBody& body = platformBodies[i];
+        const unsigned int id = body.getID();
+
+        if (id < denseLimit) {
+            if (m_denseIds[id] == NoIndex) m_denseIds[id] = i;
+        } else {
+            m_sparseIds.emplace(id, i); // emplace keeps the first one on duplicates
+        }
+
+        switch (body.getType()) {
+            case phys::bodyType::moving: m_moving.push_back(i); break;
+            case phys::bodyType::falling: m_falling.push_back(i); m_fallingOrVanishing.push_back(i); break;
+            case phys::bodyType::vanishing: m_vanishing.push_back(i); m_fallingOrVanishing.push_back(i); break;
+            case phys::bodyType::interactible: m_interactible.push_back(i); break;
+            default: break;
+        }
+    }
+}
+
+void LevelRuntime::addBodies(const std::vector<phys::PlatformBody>& platformBodies, std::size_t first, std::size_t count) {
+    // the dense table grows with the level, ids that went sparse before stay there (indexOf looks in both)
+    const std::size_t denseLimit = platformBodies.size() * 4 + 1024;
+    if (m_denseIds.size() < denseLimit) m_denseIds.resize(denseLimit, NoIndex);
+
+    std::vector<std::size_t> moving, falling, vanishing, interactible, fallingOrVanishing;
+    for (std::size_t i = first; i < first + count; ++i) {
+        const phys::PlatformBody& body = platformBodies[i];
+        const unsigned int id = body.getID();
+        if (id < m_denseIds.size()) {
+            if (m_denseIds[id] == NoIndex) m_denseIds[id] = i;
+        } else {
+            m_sparseIds.emplace(id, i);
+        }
+
+        switch (body.getType()) {
+            case phys::bodyType::moving: moving.push_back(i); break;
+            case phys::bodyType::falling: falling.push_back(i); fallingOrVanishing.push_back(i); break;
+            case phys::bodyType::vanishing: vanishing.push_back(i); fallingOrVanishing.push_back(i); break;
+            case phys::bodyType::interactible: interactible.push_back(i); break;
+            default: break;
+        }
+    }
+
+    // the range was free, so its indices all go in at one spot
+    auto insertRun = [first](std::vector<std::size_t>& list, const std::vector<std::size_t>& run) {
+        if (run.empty()) return;
+        list.insert(std::lower_bound(list.begin(), list.end(), first), run.begin(), run.end());
+    };
+    insertRun(m_moving, moving);
+    insertRun(m_falling, falling);
+    insertRun(m_vanishing, vanishing);
+    insertRun(m_interactible, interactible);
+    insertRun(m_fallingOrVanishing, fallingOrVanishing);
+}
+
+void LevelRuntime::removeBodies(const std::vector<phys::PlatformBody>& platformBodies, std::size_t first, std::size_t count) {
+    const std::size_t end = first + count;
+    for (std::size_t i = first; i < end; ++i) {
+        const unsigned int id = platformBodies[i].getID();
+        // duplicates elsewhere keep their own entry, only a lookup that lands in the range goes
+        if (id < m_denseIds.size() && m_denseIds[id] >= first && m_denseIds[id] < end) {
+            m_denseIds[id] = NoIndex;
+            continue;
+        }
+        auto sparse = m_sparseIds.find(id);
+        if (sparse != m_sparseIds.end() && sparse->second >= first && sparse->second < end) m_sparseIds.erase(sparse);
+    }
+
+    for (std::vector<std::size_t>* list : {&m_moving, &m_falling, &m_vanishing, &m_interactible, &m_fallingOrVanishing}) {
+        auto begin = std::lower_bound(list->begin(), list->end(), first);
+        list->erase(begin, std::lower_bound(begin, list->end(), end));
+    }
+}
+
+std::size_t LevelRuntime::allocateBodies(std::size_t count, std::size_t bodyCount) {
+    for (auto it = m_freeBodies.begin(); it != m_freeBodies.end(); ++it) {
+        if (it->count < count) continue;
+        const std::size_t first = it->first;
+        it->first += count;
+        it->count -= count;
+        if (it->count == 0) m_freeBodies.erase(it);
+        return first;
+    }
+    // a free run at the very end can still be grown into
+    if (!m_freeBodies.empty() && m_freeBodies.back().first + m_freeBodies.back().count == bodyCount) {
+        const std::size_t first = m_freeBodies.back().first;
+        m_freeBodies.pop_back();
+        return first;
+    }
+    return bodyCount;
+}
+
+void LevelRuntime::releaseBodies(std::size_t first, std::size_t count) {
+    if (count == 0) return;
+    auto next = std::lower_bound(m_freeBodies.begin(), m_freeBodies.end(), first,
+                                 [](const BodyRange& range, std::size_t value) { return range.first < value; });
+    next = m_freeBodies.insert(next, BodyRange{first, count});
+    if (next + 1 != m_freeBodies.end() && next->first + next->count == (next + 1)->first) {
+        next->count += (next + 1)->count;
+        m_freeBodies.erase(next + 1);
+    }
+    if (next != m_freeBodies.begin() && (next - 1)->first + (next - 1)->count == next->first) {
+        (next - 1)->count += next->count;
+        m_freeBodies.erase(next);
+    }
+}
+
+std::size_t LevelRuntime::indexOf(unsigned int id) const {
+    if (id < m_denseIds.size() && m_denseIds[id] != NoIndex) return m_denseIds[id];
+    auto it = m_sparseIds.find(id);
+    return it != m_sparseIds.end() ? it->second : NoIndex;
+}
@@ -0,0 +1,323 @@
+#include "LevelStreamer.hpp"
+#include "LevelManager.hpp"
+#include "LevelBinary.hpp"
+#include "SpriteManager.hpp"
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace {
+    sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+        const float minX = std::min(a.position.x, b.position.x);
+        const float minY = std::min(a.position.y, b.position.y);
+        const float maxX = std::max(a.position.x + a.size.x, b.position.x + b.size.x);
+        const float maxY = std::max(a.position.y + a.size.y, b.position.y + b.size.y);
+        return sf::FloatRect({minX, minY}, {maxX - minX, maxY - minY});
+    }
+
+    bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+        return a.position.x <= b.position.x + b.size.x && b.position.x <= a.position.x + a.size.x
+            && a.position.y <= b.position.y + b.size.y && b.position.y <= a.position.y + a.size.y;
+    }
+
+    sf::Vector2i cellOf(const sf::Vector2f& point, float chunkSize) {
+        return {static_cast<int>(std::floor(point.x / chunkSize)), static_cast<int>(std::floor(point.y / chunkSize))};
+    }
+}
+
+LevelStreamer::LevelStreamer(TextureCache& textureCache, ThreadPool& pool)
+    : m_textureCache(textureCache), m_pool(pool) {}
+
+// load jobs only hold their own copies of the paths and a reference on the level file, nothing here has to outlive them
+LevelStreamer::~LevelStreamer() = default;
+
+bool LevelStreamer::partition(LevelData& level) const {
+    // levelc already split a compiled level, its platforms are still in the file
+    if (!level.chunks.empty()) return true;
+    level.chunkSize = 0.f;
+    if (level.platforms.size() < m_settings.platformThreshold || m_settings.chunkSize <= 0.f) return false;
+
+    const auto start = std::chrono::steady_clock::now();
+    const float chunkSize = m_settings.chunkSize;
+
+    // a moving platform belongs to the chunk it starts in, but the chunk has to cover everywhere it goes
+    std::unordered_map<unsigned int, float> movingReach;
+    for (const auto& detail : level.movingPlatformDetails) movingReach[detail.id] = std::abs(detail.distance);
+
+    std::map<std::pair<int, int>, std::size_t> chunkOfCell; // ordered, so chunks come out in the same order every load
+    std::vector<std::size_t> chunkOf(level.platforms.size());
+    for (std::size_t i = 0; i < level.platforms.size(); ++i) {
+        const phys::PlatformBody& platform = level.platforms[i];
+        sf::FloatRect area = platform.getAABB();
+        const sf::Vector2i cell = cellOf(area.position + area.size / 2.f, chunkSize);
+        auto reach = movingReach.find(platform.getID());
+        if (platform.getType() == phys::bodyType::moving && reach != movingReach.end()) {
+            area.position -= sf::Vector2f(reach->second, reach->second);
+            area.size += sf::Vector2f(reach->second, reach->second) * 2.f;
+        }
+
+        auto [it, inserted] = chunkOfCell.emplace(std::make_pair(cell.x, cell.y), level.chunks.size());
+        if (inserted) {
+            LevelData::Chunk chunk;
+            chunk.cell = cell;
+            chunk.bounds = area;
+            level.chunks.push_back(std::move(chunk));
+        }
+        LevelData::Chunk& chunk = level.chunks[it->second];
+        chunkOf[i] = it->second;
+        ++chunk.platformCount;
+        chunk.bounds = unite(chunk.bounds, area);
+        const std::string texturePath = platform.getTexturePath();
+        if (std::find(chunk.texturePaths.begin(), chunk.texturePaths.end(), texturePath) == chunk.texturePaths.end()) {
+            chunk.texturePaths.push_back(texturePath);
+        }
+    }
+
+    // then the platforms themselves move into their chunk, the level keeps none of its own
+    for (LevelData::Chunk& chunk : level.chunks) chunk.platforms.reserve(chunk.platformCount);
+    for (std::size_t i = 0; i < level.platforms.size(); ++i) {
+        LevelData::Chunk& chunk = level.chunks[chunkOf[i]];
+        auto dimensions = level.TexturesDimensions.find(static_cast<int>(level.platforms[i].getID()));
+        if (dimensions != level.TexturesDimensions.end()) chunk.dimensions.insert(*dimensions);
+        chunk.platforms.push_back(std::move(level.platforms[i]));
+    }
+    const std::size_t platformCount = level.platforms.size();
+    std::vector<phys::PlatformBody>().swap(level.platforms);
+    level.TexturesDimensions.clear();
+    level.chunkSize = chunkSize;
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "LevelStreamer: " << platformCount << " platforms split into " << level.chunks.size() << " chunks of "
+              << chunkSize << " units in " << ms << " ms" << std::endl;
+    return true;
+}
+
+sf::FloatRect LevelStreamer::loadArea(const sf::Vector2f& center, int radius) const {
+    // whole cells, so the area only changes when the camera crosses a chunk border
+    const float chunkSize = m_level && m_level->chunkSize > 0.f ? m_level->chunkSize : m_settings.chunkSize;
+    const sf::Vector2i cell = cellOf(center, chunkSize);
+    const sf::Vector2f topLeft(static_cast<float>(cell.x - radius) * chunkSize, static_cast<float>(cell.y - radius) * chunkSize);
+    const float side = static_cast<float>(radius * 2 + 1) * chunkSize;
+    return sf::FloatRect(topLeft, {side, side});
+}
+
+void LevelStreamer::filterTexturePaths(const LevelData& level, const sf::Vector2f& center, std::vector<std::string>& paths) const {
+    if (level.chunks.empty()) return;
+    const sf::Vector2i cell = cellOf(center, level.chunkSize);
+    const float radius = static_cast<float>(m_settings.loadRadius);
+    const sf::FloatRect area({(static_cast<float>(cell.x) - radius) * level.chunkSize, (static_cast<float>(cell.y) - radius) * level.chunkSize},
+                             {(radius * 2.f + 1.f) * level.chunkSize, (radius * 2.f + 1.f) * level.chunkSize});
+
+    std::set<std::string> needed{DEFAULT_TEXTURE_FILEPATH};
+    if (!level.backgroundTexturePath.empty()) needed.insert(level.backgroundTexturePath);
+    for (const LevelData::Chunk& chunk : level.chunks) {
+        if (overlaps(chunk.bounds, area)) needed.insert(chunk.texturePaths.begin(), chunk.texturePaths.end());
+    }
+    paths.erase(std::remove_if(paths.begin(), paths.end(), [&needed](const std::string& path) { return needed.count(path) == 0; }), paths.end());
+}
+
+void LevelStreamer::start(const LevelData& level, const sf::Vector2f& center) {
+    stop();
+    if (level.chunks.empty()) return;
+    m_level = &level;
+    m_chunks.resize(level.chunks.size());
+
+    const sf::FloatRect area = loadArea(center, m_settings.loadRadius);
+    for (std::size_t i = 0; i < level.chunks.size(); ++i) {
+        if (!overlaps(level.chunks[i].bounds, area)) continue;
+        if (level.chunkFile && !level.chunkFile->readChunk(i, m_chunks[i].platforms, m_chunks[i].dimensions)) {
+            std::cerr << "LevelStreamer Error: Could not read chunk " << i << " from the level file, it stays empty." << std::endl;
+        }
+        makeResident(i);
+    }
+    m_lastCenterCell = cellOf(center, level.chunkSize);
+    m_wantedDirty = false;
+}
+
+void LevelStreamer::stop() {
+    // unfinished decodes just finish into nothing, their futures don't block on destruction
+    m_chunks.clear();
+    m_pinned.clear();
+    m_loading.clear();
+    m_activated.clear();
+    m_evicted.clear();
+    m_level = nullptr;
+    m_residentCount = 0;
+    m_wantedDirty = true;
+}
+
+bool LevelStreamer::needsLoad(const std::string& path) {
+    return m_pinned.find(path) == m_pinned.end() && !m_textureCache.contains(path);
+}
+
+void LevelStreamer::makeResident(std::size_t chunk) {
+    for (const std::string& path : m_level->chunks[chunk].texturePaths) {
+        auto pinned = m_pinned.find(path);
+        if (pinned != m_pinned.end()) {
+            ++pinned->second.chunks;
+            continue;
+        }
+        // normally a cache hit, the decode job (or the level load) put it there. acquire covers anything evicted since
+        std::shared_ptr<sf::Texture> texture = m_textureCache.acquire(path);
+        if (!texture) texture = m_textureCache.acquire(DEFAULT_TEXTURE_FILEPATH);
+        m_pinned[path] = PinnedTexture{std::move(texture), 1};
+    }
+    m_chunks[chunk].state = ChunkState::Resident;
+    m_activated.push_back(chunk);
+    ++m_residentCount;
+    ++m_activations;
+}
+
+void LevelStreamer::evict(std::size_t chunk) {
+    for (const std::string& path : m_level->chunks[chunk].texturePaths) {
+        auto pinned = m_pinned.find(path);
+        if (pinned != m_pinned.end() && --pinned->second.chunks == 0) m_pinned.erase(pinned);
+    }
+    m_chunks[chunk].state = ChunkState::Unloaded;
+    // the caller never saw it come in, so there's nothing for it to tear down either
+    auto activated = std::find(m_activated.begin(), m_activated.end(), chunk);
+    if (activated != m_activated.end()) m_activated.erase(activated);
+    else m_evicted.push_back(chunk);
+    --m_residentCount;
+    ++m_evictions;
+}
+
+bool LevelStreamer::update(const sf::Vector2f& center) {
+    m_activated.clear();
+    // the caller is done with last update's evictions, a compiled chunk's platforms can go now (the file still has them)
+    for (std::size_t chunk : m_evicted) {
+        if (chunk >= m_chunks.size() || m_chunks[chunk].state == ChunkState::Resident) continue;
+        std::vector<phys::PlatformBody>().swap(m_chunks[chunk].platforms);
+        m_chunks[chunk].dimensions.clear();
+    }
+    m_evicted.clear();
+    if (!m_level) return false;
+    bool changed = false;
+    const int radius = std::max(0, m_settings.loadRadius);
+    // one chunk of slack before anything is evicted, walking back and forth over a border shouldn't reload
+    const sf::FloatRect keepArea = loadArea(center, radius + 1);
+
+    // finished decodes go up to the gpu, at least one chunk a frame then while the budget lasts
+    const auto uploadStart = std::chrono::steady_clock::now();
+    bool uploadedAny = false;
+    for (auto it = m_loading.begin(); it != m_loading.end();) {
+        ChunkRuntime& runtime = m_chunks[*it];
+        if (runtime.load.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+        const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - uploadStart).count();
+        if (uploadedAny && elapsedMs >= m_settings.uploadBudgetMs) break;
+
+        ChunkLoad load = runtime.load.get();
+        for (DecodedImage& decoded : load.images) {
+            sf::Texture texture;
+            if (decoded.loaded && texture.loadFromImage(decoded.image)) {
+                m_textureCache.insert(decoded.path, std::move(texture));
+            } else {
+                std::cerr << "LevelStreamer Error: Failed to load texture '" << decoded.path << "'. Using default." << std::endl;
+            }
+        }
+        if (!load.platformsRead) {
+            std::cerr << "LevelStreamer Error: Could not read chunk " << *it << " from the level file, it stays empty." << std::endl;
+        }
+        uploadedAny = true;
+        runtime.state = ChunkState::Unloaded;
+        // the camera may have moved on while it decoded, then the textures just stay in the cache for later
+        if (overlaps(m_level->chunks[*it].bounds, keepArea)) {
+            runtime.platforms = std::move(load.platforms);
+            runtime.dimensions = std::move(load.dimensions);
+            makeResident(*it);
+            changed = true;
+        }
+        it = m_loading.erase(it);
+    }
+
+    const sf::Vector2i cell = cellOf(center, m_level->chunkSize);
+    if (!m_wantedDirty && cell == m_lastCenterCell) return changed;
+    m_lastCenterCell = cell;
+    m_wantedDirty = false;
+
+    const sf::FloatRect area = loadArea(center, radius);
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        ChunkRuntime& runtime = m_chunks[i];
+        const LevelData::Chunk& chunk = m_level->chunks[i];
+        if (runtime.state == ChunkState::Resident && !overlaps(chunk.bounds, keepArea)) {
+            evict(i);
+            changed = true;
+            continue;
+        }
+        if (runtime.state != ChunkState::Unloaded || !overlaps(chunk.bounds, area)) continue;
+
+        std::vector<std::string> missing;
+        for (const std::string& path : chunk.texturePaths) {
+            if (needsLoad(path)) missing.push_back(path);
+        }
+        if (missing.empty() && !m_level->chunkFile) {
+            makeResident(i); // everything it needs is up already, no reason to wait a frame
+            changed = true;
+            continue;
+        }
+        runtime.state = ChunkState::Loading;
+        runtime.load = m_pool.submit([paths = std::move(missing), file = m_level->chunkFile, chunk = i]() {
+            ChunkLoad load;
+            load.images.resize(paths.size());
+            for (std::size_t p = 0; p < paths.size(); ++p) {
+                load.images[p].path = paths[p];
+                load.images[p].loaded = load.images[p].image.loadFromFile(paths[p]);
+            }
+            if (file) load.platformsRead = file->readChunk(chunk, load.platforms, load.dimensions);
+            return load;
+        });
+        m_loading.push_back(i);
+    }
+
+    // still over the cap (big overhanging chunks, a large radius): farthest resident chunks outside the load area go first
+    const std::size_t side = static_cast<std::size_t>(radius * 2 + 1);
+    const std::size_t cap = std::max(m_settings.maxResident, side * side);
+    if (m_residentCount > cap) {
+        std::vector<std::pair<long long, std::size_t>> candidates;
+        for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+            if (m_chunks[i].state != ChunkState::Resident || overlaps(m_level->chunks[i].bounds, area)) continue;
+            const long long dx = m_level->chunks[i].cell.x - cell.x;
+            const long long dy = m_level->chunks[i].cell.y - cell.y;
+            candidates.emplace_back(dx * dx + dy * dy, i);
+        }
+        std::sort(candidates.begin(), candidates.end(), std::greater<>());
+        for (std::size_t c = 0; c < candidates.size() && m_residentCount > cap; ++c) {
+            evict(candidates[c].second);
+            changed = true;
+        }
+    }
+    if (changed) m_textureCache.trim(); // unpinned textures are fair game now
+    return changed;
+}
+
+const std::vector<phys::PlatformBody>& LevelStreamer::getChunkPlatforms(std::size_t chunk) const {
+    return m_level->chunkFile ? m_chunks[chunk].platforms : m_level->chunks[chunk].platforms;
+}
+
+const std::map<int, sf::IntRect>& LevelStreamer::getChunkDimensions(std::size_t chunk) const {
+    return m_level->chunkFile ? m_chunks[chunk].dimensions : m_level->chunks[chunk].dimensions;
+}
+
+const sf::Texture* LevelStreamer::findTexture(const std::string& path) const {
+    auto it = m_pinned.find(path);
+    return it != m_pinned.end() ? it->second.texture.get() : nullptr;
+}
+
+LevelStreamer::Stats LevelStreamer::getStats() const {
+    Stats stats;
+    stats.chunks = m_chunks.size();
+    stats.resident = m_residentCount;
+    stats.loading = m_loading.size();
+    stats.activations = m_activations;
+    stats.evictions = m_evictions;
+    stats.pinnedTextures = m_pinned.size();
+    return stats;
+}
@@ -14,9 +14,9 @@ DynamicBody::DynamicBody(
       m_width(width),
       m_height(height),
       m_onGround(false),
-      m_groundPlatform(nullptr),
+      m_groundPlatform(),
       m_isTryingToDrop(false),
-      m_tempIgnoredPlatform(nullptr)
+      m_tempIgnoredPlatform()
 {
 }
 
@@ -45,11 +45,11 @@ void DynamicBody::setLastPosition(const sf::Vector2f& position) {
 }
 
 // --- Specific Platform Interaction Logic Implementation ---
-void DynamicBody::setGroundPlatform(const PlatformBody* platform) {
+void DynamicBody::setGroundPlatform(BodyHandle platform) {
     m_groundPlatform = platform;
 }
 
-const PlatformBody* DynamicBody::getGroundPlatform() const {
+BodyHandle DynamicBody::getGroundPlatform() const {
     return m_groundPlatform;
 }
 
@@ -61,11 +61,11 @@ bool DynamicBody::isTryingToDropFromPlatform() const {
     return m_isTryingToDrop;
 }
 
-void DynamicBody::setGroundPlatformTemporarilyIgnored(const PlatformBody* platform) {
+void DynamicBody::setGroundPlatformTemporarilyIgnored(BodyHandle platform) {
     m_tempIgnoredPlatform = platform;
 }
 
-const PlatformBody* DynamicBody::getGroundPlatformTemporarilyIgnored() const {
+BodyHandle DynamicBody::getGroundPlatformTemporarilyIgnored() const {
     return m_tempIgnoredPlatform;
 }
 
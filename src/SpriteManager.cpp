@@ -1,31 +1,9 @@
 #include "SpriteManager.hpp"
-
-sprites::SpriteManager::SpriteManager(){
-    if (!defaultTexture.loadFromFile(defaultTexturePath)){
-        std::cerr << "Error loading default texture." << std::endl;
-    }
-}
-
-std::vector<sf::Texture> LoadLevelTextures(std::vector<std::string> texturePaths){
-    // for consistency, first element will be default texture
-    sf::Texture defaultTexture(DEFAULT_TEXTURE_FILEPATH);
-
-    std::vector<sf::Texture> TextureList;
-    TextureList.push_back(defaultTexture);
-
-    for (std::string txPath : texturePaths){
-        sf::Texture newTexture(DEFAULT_TEXTURE_FILEPATH);
-        if (!newTexture.loadFromFile(TEXTURE_DIRECTORY+txPath) && !newTexture.loadFromFile(txPath)){
-            std::cerr << "Erorr loading texture: " << txPath << std::endl;
-            newTexture.loadFromFile(DEFAULT_TEXTURE_FILEPATH);
-        }
-        else {
-            TextureList.push_back(newTexture);
-        }
-    }
-
-    return TextureList;
-}
+#include "LevelManager.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
 
 sf::IntRect sprites::SpriteManager::GetPlayerTextureUponMovement(PlayerMoveDirection direction){
     // Returns player texture section to be rendered, depending on current direction of movement
@@ -44,28 +22,167 @@ sf::IntRect sprites::SpriteManager::GetPlayerTextureUponMovement(PlayerMoveDirec
     }
 }
 
-bool sprites::SpriteManager::DoorAnimation(Tile& doorSprite){
-    sf::Clock animClock;
-    float secondsPerFrame = 0.20f;
-    sf::Time frameTime = sf::seconds(secondsPerFrame);
-    int current = 0;
-    int end = 4;
-    int width = 455;
-    int height = 610;
-    std::vector<sf::Vector2f>animFramesTopLeft;
-    animFramesTopLeft.push_back(sf::Vector2f(1275, 255));
-    animFramesTopLeft.push_back(sf::Vector2f(250, 1275));
-    animFramesTopLeft.push_back(sf::Vector2f(1275, 1275));
-    animFramesTopLeft.push_back(sf::Vector2f(250, 2305));
-
-    if (current < end){
-    if (animClock.getElapsedTime() >= frameTime){
-        animClock.restart();
-
-        doorSprite.setTextureRect(sf::IntRect({animFramesTopLeft[current].x, animFramesTopLeft[current].y},
-                                    {width, height}));
-        
-        current++;
+void sprites::SpriteManager::clearAnimations(){
+    m_clips.clear();
+    m_time.clear();
+    m_frame.clear();
+    m_playing.clear();
+    m_finished.clear();
+    m_autoplay.clear();
+    m_tileOf.clear();
+    m_animationOfId.clear();
+    m_animatedTiles.clear();
+    m_frameChanges = 0;
+}
+
+void sprites::SpriteManager::loadAnimations(const LevelData& levelData){
+    clearAnimations();
+    if (levelData.animationDetails.empty()) return;
+
+    std::unordered_set<unsigned int> platformIds;
+    for (const phys::PlatformBody& platform : levelData.platforms) platformIds.insert(platform.getID());
+    const bool checkIds = levelData.chunks.empty();
+
+    for (const LevelData::AnimationInfo& info : levelData.animationDetails){
+        if ((checkIds && platformIds.count(info.id) == 0) || info.frames.empty() || info.frames.size() != info.durations.size()){
+            std::cerr << "SpriteManager Warning: Animation for platform " << info.id << " has no platform or no frames, skipped." << std::endl;
+            continue;
+        }
+        if (m_animationOfId.count(info.id) != 0) continue; // one animation per platform, the first one wins
+
+        Clip clip;
+        clip.loop = static_cast<std::uint8_t>(info.loop);
+        clip.frames = info.frames;
+        clip.frameEnds.reserve(info.durations.size());
+        float end = 0.f;
+        for (float duration : info.durations){
+            end += std::max(0.f, duration);
+            clip.frameEnds.push_back(end);
+        }
+        if (end <= 0.f){
+            std::cerr << "SpriteManager Warning: Animation for platform " << info.id << " has no length, skipped." << std::endl;
+            continue;
+        }
+
+        m_animationOfId.emplace(info.id, m_clips.size());
+        m_clips.push_back(std::move(clip));
+        m_autoplay.push_back(info.autoplay ? 1 : 0);
+    }
+
+    const std::size_t count = m_clips.size();
+    m_time.assign(count, 0.f);
+    m_frame.assign(count, 0);
+    m_playing.assign(m_autoplay.begin(), m_autoplay.end());
+    m_finished.assign(count, 0);
+    m_tileOf.assign(count, NoAnimation);
+}
+
+void sprites::SpriteManager::resetAnimations(){
+    std::fill(m_time.begin(), m_time.end(), 0.f);
+    std::fill(m_frame.begin(), m_frame.end(), 0);
+    std::copy(m_autoplay.begin(), m_autoplay.end(), m_playing.begin());
+    std::fill(m_finished.begin(), m_finished.end(), 0);
+}
+
+void sprites::SpriteManager::bindAnimations(std::vector<Tile>& tiles, const std::vector<phys::PlatformBody>& bodies){
+    std::fill(m_tileOf.begin(), m_tileOf.end(), NoAnimation);
+    m_animatedTiles.clear();
+    bindAnimations(tiles, bodies, 0, bodies.size());
+}
+
+void sprites::SpriteManager::bindAnimations(std::vector<Tile>& tiles, const std::vector<phys::PlatformBody>& bodies, std::size_t first, std::size_t count){
+    if (m_clips.empty()) return;
+    for (std::size_t i = first; i < first + count && i < bodies.size() && i < tiles.size(); ++i){
+        auto it = m_animationOfId.find(bodies[i].getID());
+        if (it == m_animationOfId.end() || m_tileOf[it->second] != NoAnimation) continue;
+        const std::size_t animation = it->second;
+        m_tileOf[animation] = i;
+        m_animatedTiles.push_back(i);
+        // a fresh tile has the platform's dimensions rect, the animation may be further along than that
+        if (m_frame[animation] != NoFrame) tiles[i].setTextureRect(m_clips[animation].frames[m_frame[animation]]);
+    }
+}
+
+void sprites::SpriteManager::unbindAnimations(std::size_t first, std::size_t count){
+    auto inRange = [first, count](std::size_t tile){ return tile >= first && tile - first < count; };
+    for (std::size_t& tile : m_tileOf){
+        if (tile != NoAnimation && inRange(tile)) tile = NoAnimation;
+    }
+    m_animatedTiles.erase(std::remove_if(m_animatedTiles.begin(), m_animatedTiles.end(), inRange), m_animatedTiles.end());
+}
+
+std::size_t sprites::SpriteManager::animationOfTile(std::size_t tileIndex) const{
+    for (std::size_t a = 0; a < m_tileOf.size(); ++a){
+        if (m_tileOf[a] == tileIndex) return a;
+    }
+    return NoAnimation;
+}
+
+std::size_t sprites::SpriteManager::tileOfAnimation(std::size_t animation) const{
+    return animation < m_tileOf.size() ? m_tileOf[animation] : NoAnimation;
+}
+
+void sprites::SpriteManager::playAnimation(std::size_t animation){
+    if (animation >= m_clips.size()) return;
+    m_time[animation] = 0.f;
+    m_frame[animation] = NoFrame;
+    m_playing[animation] = 1;
+    m_finished[animation] = 0;
+}
+
+bool sprites::SpriteManager::isAnimationFinished(std::size_t animation) const{
+    return animation >= m_finished.size() || m_finished[animation] != 0;
+}
+
+std::size_t sprites::SpriteManager::frameAt(const Clip& clip, float time){
+    const float length = clip.frameEnds.back();
+    // ping pong runs the clip forwards then backwards over 2 * length
+    if (clip.loop == static_cast<std::uint8_t>(LevelData::AnimationLoop::PingPong) && time >= length) time = 2.f * length - time;
+    const std::size_t frame = static_cast<std::size_t>(std::upper_bound(clip.frameEnds.begin(), clip.frameEnds.end(), time) - clip.frameEnds.begin());
+    return std::min(frame, clip.frames.size() - 1);
+}
+
+void sprites::SpriteManager::updateAnimations(sf::Time deltaTime, std::vector<Tile>& tiles, TileChangeList& changes){
+    const float seconds = deltaTime.asSeconds();
+    m_frameChanges = 0;
+    for (std::size_t a = 0; a < m_clips.size(); ++a){
+        if (!m_playing[a]) continue;
+        const Clip& clip = m_clips[a];
+        const float length = clip.frameEnds.back();
+        float time = m_time[a] + seconds;
+        switch (static_cast<LevelData::AnimationLoop>(clip.loop)){
+            case LevelData::AnimationLoop::Once:
+                if (time >= length){
+                    time = length;
+                    m_playing[a] = 0;
+                    m_finished[a] = 1;
+                }
+                break;
+            case LevelData::AnimationLoop::Loop:
+                time = std::fmod(time, length);
+                break;
+            case LevelData::AnimationLoop::PingPong:
+                time = std::fmod(time, 2.f * length);
+                break;
+        }
+        m_time[a] = time;
+
+        const std::size_t frame = frameAt(clip, time);
+        if (frame == m_frame[a]) continue;
+        m_frame[a] = frame;
+        ++m_frameChanges;
+        const std::size_t tile = m_tileOf[a];
+        if (tile == NoAnimation || tile >= tiles.size()) continue;
+        tiles[tile].setTextureRect(clip.frames[frame]);
+        changes.mark(tile, TileChangeList::TextureRect);
     }
 }
+
+sprites::SpriteManager::AnimationStats sprites::SpriteManager::getAnimationStats() const{
+    AnimationStats stats;
+    stats.animations = m_clips.size();
+    for (std::uint8_t playing : m_playing) stats.playing += playing;
+    stats.bound = m_animatedTiles.size();
+    stats.frameChanges = m_frameChanges;
+    return stats;
 }
@@ -0,0 +1,199 @@
+#include "TextureAtlas.hpp"
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+
+namespace {
+    // skyline bottom-left: keeps the top edge of everything placed so far as a list of horizontal segments
+    // and drops each rect where its top ends up lowest. good fill for a handful of mixed size sprites, and cheap
+    class SkylinePacker {
+    public:
+        SkylinePacker(int width, int height) : m_width(width), m_height(height) {
+            m_skyline.push_back({0, 0, width});
+        }
+
+        bool insert(int width, int height, sf::Vector2i& outPosition) {
+            int bestTop = INT_MAX;
+            int bestSegmentWidth = INT_MAX;
+            std::size_t bestIndex = m_skyline.size();
+            for (std::size_t i = 0; i < m_skyline.size(); ++i) {
+                int y = 0;
+                if (!fits(i, width, height, y)) continue;
+                if (y + height < bestTop || (y + height == bestTop && m_skyline[i].width < bestSegmentWidth)) {
+                    bestTop = y + height;
+                    bestSegmentWidth = m_skyline[i].width;
+                    bestIndex = i;
+                    outPosition = {m_skyline[i].x, y};
+                }
+            }
+            if (bestIndex == m_skyline.size()) return false;
+
+            place(bestIndex, outPosition, width, height);
+            m_usedWidth = std::max(m_usedWidth, outPosition.x + width);
+            m_usedHeight = std::max(m_usedHeight, outPosition.y + height);
+            return true;
+        }
+
+        int getUsedWidth() const { return m_usedWidth; }
+        int getUsedHeight() const { return m_usedHeight; }
+
+    private:
+        struct Segment {
+            int x;
+            int y;
+            int width;
+        };
+
+        // y is where the rect would rest when its left edge starts at segment index
+        bool fits(std::size_t index, int width, int height, int& y) const {
+            if (m_skyline[index].x + width > m_width) return false;
+            y = m_skyline[index].y;
+            int widthLeft = width;
+            for (std::size_t i = index; widthLeft > 0; ++i) {
+                y = std::max(y, m_skyline[i].y);
+                if (y + height > m_height) return false;
+                widthLeft -= m_skyline[i].width;
+            }
+            return true;
+        }
+
+        void place(std::size_t index, const sf::Vector2i& position, int width, int height) {
+            m_skyline.insert(m_skyline.begin() + index, Segment{position.x, position.y + height, width});
+
+            // whatever the new segment covers gets cut off the segments after it
+            for (std::size_t i = index + 1; i < m_skyline.size();) {
+                const int newRight = m_skyline[i - 1].x + m_skyline[i - 1].width;
+                if (m_skyline[i].x >= newRight) break;
+                const int shrink = newRight - m_skyline[i].x;
+                if (m_skyline[i].width <= shrink) {
+                    m_skyline.erase(m_skyline.begin() + i);
+                    continue;
+                }
+                m_skyline[i].x += shrink;
+                m_skyline[i].width -= shrink;
+                break;
+            }
+
+            // neighbours at the same height are one segment
+            for (std::size_t i = 0; i + 1 < m_skyline.size();) {
+                if (m_skyline[i].y == m_skyline[i + 1].y) {
+                    m_skyline[i].width += m_skyline[i + 1].width;
+                    m_skyline.erase(m_skyline.begin() + i + 1);
+                } else {
+                    ++i;
+                }
+            }
+        }
+
+        int m_width;
+        int m_height;
+        int m_usedWidth = 0;
+        int m_usedHeight = 0;
+        std::vector<Segment> m_skyline;
+    };
+
+    struct Placement {
+        std::size_t source;
+        std::size_t page;
+        sf::Vector2i position;
+    };
+}
+
+void TextureAtlas::clear() {
+    m_pages.clear();
+    m_regions.clear();
+    m_stats = Stats();
+}
+
+bool TextureAtlas::build(const std::vector<Source>& sources, unsigned int pageSize, unsigned int padding) {
+    clear();
+    const auto start = std::chrono::steady_clock::now();
+    const int page = static_cast<int>(std::min(pageSize, sf::Texture::getMaximumSize()));
+    const int pad = static_cast<int>(padding);
+
+    // tallest first, the skyline stays flatter that way
+    std::vector<std::size_t> order;
+    order.reserve(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        if (sources[i].texture) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&sources](std::size_t a, std::size_t b) {
+        const sf::Vector2u sizeA = sources[a].texture->getSize();
+        const sf::Vector2u sizeB = sources[b].texture->getSize();
+        if (sizeA.y != sizeB.y) return sizeA.y > sizeB.y;
+        if (sizeA.x != sizeB.x) return sizeA.x > sizeB.x;
+        return a < b;
+    });
+
+    std::vector<SkylinePacker> packers;
+    std::vector<Placement> placements;
+    placements.reserve(order.size());
+    for (std::size_t index : order) {
+        const sf::Vector2u size = sources[index].texture->getSize();
+        const int width = static_cast<int>(size.x) + pad;
+        const int height = static_cast<int>(size.y) + pad;
+        if (size.x == 0 || size.y == 0 || width > page || height > page) {
+            ++m_stats.skipped;
+            continue;
+        }
+
+        Placement placement{index, 0, {0, 0}};
+        bool placed = false;
+        for (std::size_t p = 0; p < packers.size() && !placed; ++p) {
+            if (packers[p].insert(width, height, placement.position)) {
+                placement.page = p;
+                placed = true;
+            }
+        }
+        if (!placed) {
+            packers.emplace_back(page, page);
+            placement.page = packers.size() - 1;
+            placed = packers.back().insert(width, height, placement.position);
+        }
+        if (!placed) {
+            ++m_stats.skipped;
+            continue;
+        }
+        placements.push_back(placement);
+        m_stats.usedTexels += std::size_t(size.x) * size.y;
+    }
+
+    // pages only as big as what landed on them
+    m_pages.reserve(packers.size());
+    for (const SkylinePacker& packer : packers) {
+        auto target = std::make_unique<sf::RenderTexture>();
+        const sf::Vector2u pageSizeUsed(static_cast<unsigned int>(packer.getUsedWidth()), static_cast<unsigned int>(packer.getUsedHeight()));
+        if (!target->resize(pageSizeUsed)) {
+            std::cerr << "TextureAtlas Error: Could not create a " << pageSizeUsed.x << "x" << pageSizeUsed.y << " page." << std::endl;
+            clear();
+            return false;
+        }
+        target->clear(sf::Color::Transparent);
+        m_stats.pageTexels += std::size_t(pageSizeUsed.x) * pageSizeUsed.y;
+        m_pages.push_back(std::move(target));
+    }
+
+    // straight copy, alpha included, no blending against the cleared page
+    const sf::RenderStates copyStates(sf::BlendNone);
+    for (const Placement& placement : placements) {
+        const Source& source = sources[placement.source];
+        sf::Sprite sprite(*source.texture);
+        sprite.setPosition(sf::Vector2f(placement.position));
+        m_pages[placement.page]->draw(sprite, copyStates);
+        m_regions[source.key] = Region{placement.page, sf::IntRect(placement.position, sf::Vector2i(source.texture->getSize()))};
+    }
+    for (auto& target : m_pages) target->display();
+
+    m_stats.pages = m_pages.size();
+    m_stats.packed = placements.size();
+    m_stats.packMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+const TextureAtlas::Region* TextureAtlas::find(const std::string& key) const {
+    auto it = m_regions.find(key);
+    return it != m_regions.end() ? &it->second : nullptr;
+}
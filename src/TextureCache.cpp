@@ -0,0 +1,108 @@
+#include "TextureCache.hpp"
+#include <filesystem>
+#include <iostream>
+
+TextureCache::TextureCache(std::size_t byteBudget) : m_byteBudget(byteBudget) {}
+
+void TextureCache::setByteBudget(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_byteBudget = bytes;
+    trimLocked();
+}
+
+std::string TextureCache::canonicalPath(const std::string& path) {
+    // lexical only, no disk access, so a missing file still gets a stable key
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+std::size_t TextureCache::textureBytes(const sf::Texture& texture) {
+    return std::size_t(texture.getSize().x) * texture.getSize().y * 4;
+}
+
+void TextureCache::touch(Entry& entry) {
+    m_lru.splice(m_lru.begin(), m_lru, entry.lruPosition);
+}
+
+bool TextureCache::contains(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.find(canonicalPath(path)) != m_entries.end();
+}
+
+std::shared_ptr<sf::Texture> TextureCache::find(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(canonicalPath(path));
+    if (it == m_entries.end()) {
+        ++m_misses;
+        return nullptr;
+    }
+    ++m_hits;
+    touch(it->second);
+    return it->second.texture;
+}
+
+std::shared_ptr<sf::Texture> TextureCache::insert(const std::string& path, sf::Texture&& texture) {
+    const std::string key = canonicalPath(path);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        touch(it->second);
+        return it->second.texture;
+    }
+
+    Entry entry;
+    entry.texture = std::make_shared<sf::Texture>(std::move(texture));
+    entry.bytes = textureBytes(*entry.texture);
+    m_lru.push_front(key);
+    entry.lruPosition = m_lru.begin();
+    m_bytes += entry.bytes;
+    std::shared_ptr<sf::Texture> result = entry.texture;
+    m_entries.emplace(key, std::move(entry));
+
+    trimLocked(); // the new entry is referenced by result, it can't be the one that goes
+    return result;
+}
+
+std::shared_ptr<sf::Texture> TextureCache::acquire(const std::string& path) {
+    if (std::shared_ptr<sf::Texture> cached = find(path)) return cached;
+
+    // decode outside the lock, workers asking contains() shouldn't wait on a file read
+    sf::Texture texture;
+    if (!texture.loadFromFile(path)) {
+        std::cerr << "TextureCache Error: Failed to load texture '" << path << "'." << std::endl;
+        return nullptr;
+    }
+    return insert(path, std::move(texture));
+}
+
+void TextureCache::trim() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    trimLocked();
+}
+
+void TextureCache::trimLocked() {
+    // walk from the cold end, skipping anything still held outside the cache
+    auto it = m_lru.end();
+    while (m_bytes > m_byteBudget && it != m_lru.begin()) {
+        --it;
+        auto entryIt = m_entries.find(*it);
+        if (entryIt->second.texture.use_count() > 1) continue;
+        m_bytes -= entryIt->second.bytes;
+        m_entries.erase(entryIt);
+        it = m_lru.erase(it);
+        ++m_evictions;
+    }
+}
+
+TextureCache::Stats TextureCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.evictions = m_evictions;
+    stats.entries = m_entries.size();
+    stats.bytes = m_bytes;
+    for (const auto& [key, entry] : m_entries) {
+        if (entry.texture.use_count() > 1) stats.pinnedBytes += entry.bytes;
+    }
+    return stats;
+}
@@ -12,6 +12,12 @@ Tile::Tile(const sf::Vector2f& size, const sf::Color& color)
     m_shape.setSize(size);
 }
 
+void Tile::setTexture(const sf::Texture* texture, const sf::IntRect& sourceRegion) {
+    m_shape.setTexture(texture);
+    m_sourceOrigin = sourceRegion.position;
+    m_shape.setTextureRect(sourceRegion);
+}
+
 void Tile::update(sf::Time deltaTime) {
     if (m_fallDelayTimer > sf::Time::Zero) {
         m_fallDelayTimer -= deltaTime;
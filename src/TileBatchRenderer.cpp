@@ -0,0 +1,498 @@
+#include "TileBatchRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+    bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+        return a.position.x <= b.position.x + b.size.x && b.position.x <= a.position.x + a.size.x
+            && a.position.y <= b.position.y + b.size.y && b.position.y <= a.position.y + a.size.y;
+    }
+
+    sf::FloatRect unite(const sf::FloatRect& a, const sf::FloatRect& b) {
+        const float minX = std::min(a.position.x, b.position.x);
+        const float minY = std::min(a.position.y, b.position.y);
+        const float maxX = std::max(a.position.x + a.size.x, b.position.x + b.size.x);
+        const float maxY = std::max(a.position.y + a.size.y, b.position.y + b.size.y);
+        return sf::FloatRect({minX, minY}, {maxX - minX, maxY - minY});
+    }
+}
+
+namespace {
+    // layers already carry color * alpha, blending them with BlendAlpha would apply alpha a second time
+    const sf::BlendMode BlendPremultiplied(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+}
+
+TileBatchRenderer::TileBatchRenderer(float cellSize, std::size_t maxLayers)
+    : m_cellSize(std::max(1.f, cellSize)), m_maxLayers(maxLayers) {}
+
+void TileBatchRenderer::setLayersEnabled(bool enabled) {
+    if (m_layersEnabled == enabled) return;
+    m_layersEnabled = enabled;
+    if (!enabled) {
+        for (std::size_t c : m_layerCells) dropLayer(m_cells[c]);
+        m_layerCells.clear();
+    }
+}
+
+void TileBatchRenderer::setLayerScale(float scale) {
+    scale = std::max(0.25f, scale);
+    if (std::abs(scale - m_layerScale) < 1e-3f) return;
+    m_layerScale = scale;
+    // every layer has the wrong resolution now, they get remade as they come into view
+    for (std::size_t c : m_layerCells) dropLayer(m_cells[c]);
+    m_layerCells.clear();
+    for (Cell& cell : m_cells) cell.layerTooBig = false;
+}
+
+std::uint64_t TileBatchRenderer::cellKey(int x, int y) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+void TileBatchRenderer::build(const std::vector<Tile>& tiles, const std::vector<std::size_t>& dynamicTiles) {
+    clear();
+    m_tiles = &tiles;
+
+    std::vector<bool> dynamic(tiles.size(), false);
+    for (std::size_t index : dynamicTiles) {
+        if (index < tiles.size()) dynamic[index] = true;
+    }
+
+    // static tiles go to the cell their top left corner is in, one batch per texture inside it.
+    // dynamic tiles get a slot here and their quad from writeSlot below, which bins them the same way
+    m_cellOf.assign(tiles.size(), NoCell);
+    m_batchOf.assign(tiles.size(), 0);
+    m_slotOf.assign(tiles.size(), NoSlot);
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        if (dynamic[i]) {
+            m_slotOf[i] = m_slots.size();
+            m_slots.emplace_back();
+            ++m_stats.dynamicTiles;
+            continue;
+        }
+        addStaticTile(i, cellIndexAt(tiles[i].getPosition()));
+    }
+
+    m_stats.tiles = tiles.size();
+    for (std::size_t c = 0; c < m_cells.size(); ++c) markDirty(c);
+
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        if (m_slotOf[i] != NoSlot) writeSlot(i, TileChangeList::All);
+    }
+    m_stats.cells = m_cells.size();
+}
+
+void TileBatchRenderer::addTiles(std::size_t first, std::size_t count, const std::vector<std::size_t>& dynamicTiles) {
+    if (!m_tiles || first + count > m_tiles->size()) return;
+    const std::size_t end = first + count;
+    if (m_cellOf.size() < m_tiles->size()) {
+        m_cellOf.resize(m_tiles->size(), NoCell);
+        m_batchOf.resize(m_tiles->size(), 0);
+        m_slotOf.resize(m_tiles->size(), NoSlot);
+    }
+
+    for (std::size_t index : dynamicTiles) {
+        if (index < first || index >= end || m_slotOf[index] != NoSlot) continue;
+        if (m_freeSlots.empty()) {
+            m_slotOf[index] = m_slots.size();
+            m_slots.emplace_back();
+        } else {
+            m_slotOf[index] = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_slots[m_slotOf[index]] = DynamicSlot();
+        }
+        ++m_stats.dynamicTiles;
+    }
+    for (std::size_t i = first; i < end; ++i) {
+        if (m_slotOf[i] != NoSlot) {
+            writeSlot(i, TileChangeList::All);
+            continue;
+        }
+        const std::size_t cellIndex = cellIndexAt((*m_tiles)[i].getPosition());
+        addStaticTile(i, cellIndex);
+        markDirty(cellIndex);
+    }
+    m_stats.tiles += count;
+}
+
+void TileBatchRenderer::removeTiles(std::size_t first, std::size_t count) {
+    const std::size_t end = std::min(first + count, m_cellOf.size());
+    std::vector<std::size_t> touched;
+    for (std::size_t i = first; i < end; ++i) {
+        if (m_slotOf[i] != NoSlot) {
+            DynamicSlot& slot = m_slots[m_slotOf[i]];
+            if (slot.cell != NoCell) removeSlotQuad(slot);
+            m_freeSlots.push_back(m_slotOf[i]);
+            m_slotOf[i] = NoSlot;
+            --m_stats.dynamicTiles;
+            --m_stats.tiles;
+            continue;
+        }
+        if (m_cellOf[i] == NoCell) continue;
+        if (std::find(touched.begin(), touched.end(), m_cellOf[i]) == touched.end()) touched.push_back(m_cellOf[i]);
+        m_cellOf[i] = NoCell;
+        --m_stats.tiles;
+    }
+
+    // a chunk is one run of indices, so each touched batch sheds it in one pass. batches left empty go, which
+    // renumbers the ones after them
+    for (std::size_t c : touched) {
+        Cell& cell = m_cells[c];
+        for (Batch& batch : cell.batches) {
+            batch.tiles.erase(std::remove_if(batch.tiles.begin(), batch.tiles.end(),
+                                             [first, end](std::size_t index) { return index >= first && index < end; }),
+                              batch.tiles.end());
+        }
+        const std::size_t batchCount = cell.batches.size();
+        cell.batches.erase(std::remove_if(cell.batches.begin(), cell.batches.end(), [](const Batch& batch) { return batch.tiles.empty(); }),
+                           cell.batches.end());
+        m_stats.batches -= batchCount - cell.batches.size();
+        for (std::size_t b = 0; b < cell.batches.size(); ++b) {
+            for (std::size_t index : cell.batches[b].tiles) m_batchOf[index] = b;
+        }
+        if (cell.batches.empty()) dropLayer(cell); // nothing left to draw into it, the layer just holds memory
+        markDirty(c);
+    }
+}
+
+std::size_t TileBatchRenderer::cellIndexAt(const sf::Vector2f& position) {
+    const int cellX = static_cast<int>(std::floor(position.x / m_cellSize));
+    const int cellY = static_cast<int>(std::floor(position.y / m_cellSize));
+    auto [it, inserted] = m_cellAt.emplace(cellKey(cellX, cellY), m_cells.size());
+    if (inserted) {
+        m_cells.emplace_back();
+        m_cells.back().dirty = false; // nothing in it to bake yet
+        m_stats.cells = m_cells.size();
+    }
+    return it->second;
+}
+
+void TileBatchRenderer::addStaticTile(std::size_t tileIndex, std::size_t cellIndex) {
+    const Tile& tile = (*m_tiles)[tileIndex];
+    Cell& cell = m_cells[cellIndex];
+    auto batch = std::find_if(cell.batches.begin(), cell.batches.end(), [&tile](const Batch& b) { return b.texture == tile.getTexture(); });
+    if (batch == cell.batches.end()) {
+        cell.batches.emplace_back();
+        cell.batches.back().texture = tile.getTexture();
+        batch = cell.batches.end() - 1;
+        ++m_stats.batches;
+    }
+    batch->tiles.push_back(tileIndex);
+    m_cellOf[tileIndex] = cellIndex;
+    m_batchOf[tileIndex] = static_cast<std::size_t>(batch - cell.batches.begin());
+    m_maxTileExtent = std::max({m_maxTileExtent, tile.getSize().x, tile.getSize().y});
+}
+
+void TileBatchRenderer::markDirty(std::size_t cellIndex) {
+    Cell& cell = m_cells[cellIndex];
+    if (cell.dirty) return;
+    cell.dirty = true;
+    m_dirtyCells.push_back(cellIndex);
+}
+
+void TileBatchRenderer::clear() {
+    m_tiles = nullptr;
+    m_cells.clear();
+    m_cellAt.clear();
+    m_cellOf.clear();
+    m_batchOf.clear();
+    m_dirtyCells.clear();
+    m_bakedQuads = 0;
+    m_maxTileExtent = 0.f;
+    m_maxDynamicExtent = 0.f;
+    m_dynamicQuads = 0;
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_slotOf.clear();
+    m_dynamicDrawCells.clear();
+    m_layerCells.clear();
+    m_drawList.clear();
+    m_stats = Stats();
+}
+
+void TileBatchRenderer::invalidate(std::size_t tileIndex) {
+    if (tileIndex >= m_cellOf.size()) return;
+    if (m_slotOf[tileIndex] != NoSlot) {
+        writeSlot(tileIndex, TileChangeList::All);
+        return;
+    }
+    if (m_cellOf[tileIndex] == NoCell) return;
+
+    // a hot reload can move, resize or retexture a static tile, it has to be found under the view where it is now
+    const Tile& tile = (*m_tiles)[tileIndex];
+    const std::size_t cellIndex = m_cellOf[tileIndex];
+    const sf::Texture* batchTexture = m_cells[cellIndex].batches[m_batchOf[tileIndex]].texture;
+    const std::size_t target = cellIndexAt(tile.getPosition());
+    if (target != cellIndex || batchTexture != tile.getTexture()) {
+        std::vector<std::size_t>& oldTiles = m_cells[cellIndex].batches[m_batchOf[tileIndex]].tiles;
+        oldTiles.erase(std::find(oldTiles.begin(), oldTiles.end(), tileIndex));
+        markDirty(cellIndex);
+        addStaticTile(tileIndex, target);
+    } else {
+        m_maxTileExtent = std::max({m_maxTileExtent, tile.getSize().x, tile.getSize().y});
+    }
+    markDirty(target);
+}
+
+void TileBatchRenderer::applyChanges(const TileChangeList& changes) {
+    m_stats.tileChanges = changes.getChangedTiles().size();
+    m_stats.quadWrites = 0;
+    if (!m_tiles) return;
+    for (std::size_t index : changes.getChangedTiles()) {
+        if (index >= m_slotOf.size()) continue;
+        if (m_slotOf[index] != NoSlot) writeSlot(index, changes.changesOf(index));
+        else invalidate(index);
+    }
+}
+
+void TileBatchRenderer::writeSlot(std::size_t tileIndex, std::uint8_t changes) {
+    const Tile& tile = (*m_tiles)[tileIndex];
+    DynamicSlot& slot = m_slots[m_slotOf[tileIndex]];
+    ++m_stats.quadWrites;
+
+    if (!isVisible(tile)) {
+        if (slot.cell != NoCell) removeSlotQuad(slot);
+        return;
+    }
+
+    // fading platforms change nothing but alpha most ticks, the quad itself stays put
+    if (changes == TileChangeList::Color && slot.cell != NoCell) {
+        sf::VertexArray& vertices = m_cells[slot.cell].dynamicBatches[slot.batch].vertices;
+        const sf::Color color = tile.getFillColor();
+        for (std::size_t v = slot.quad * 6; v < slot.quad * 6 + 6; ++v) vertices[v].color = color;
+        return;
+    }
+
+    // same cell and texture = rewrite in place, otherwise the quad moves to the array it belongs in now
+    const std::size_t cellIndex = cellIndexAt(tile.getPosition());
+    if (slot.cell != NoCell && (slot.cell != cellIndex || m_cells[slot.cell].dynamicBatches[slot.batch].texture != tile.getTexture())) {
+        removeSlotQuad(slot);
+    }
+    if (slot.cell == NoCell) {
+        Cell& cell = m_cells[cellIndex];
+        auto batch = std::find_if(cell.dynamicBatches.begin(), cell.dynamicBatches.end(), [&tile](const Batch& b) { return b.texture == tile.getTexture(); });
+        if (batch == cell.dynamicBatches.end()) {
+            cell.dynamicBatches.emplace_back();
+            cell.dynamicBatches.back().texture = tile.getTexture();
+            batch = cell.dynamicBatches.end() - 1;
+        }
+        slot.cell = cellIndex;
+        slot.batch = static_cast<std::size_t>(batch - cell.dynamicBatches.begin());
+        slot.quad = batch->tiles.size();
+        batch->tiles.push_back(tileIndex);
+        batch->vertices.resize(batch->tiles.size() * 6);
+        ++cell.dynamicQuads;
+        ++m_dynamicQuads;
+    }
+    m_maxDynamicExtent = std::max({m_maxDynamicExtent, tile.getSize().x, tile.getSize().y});
+    writeQuad(tile, m_cells[slot.cell].dynamicBatches[slot.batch].vertices, slot.quad * 6);
+}
+
+void TileBatchRenderer::removeSlotQuad(DynamicSlot& slot) {
+    Cell& cell = m_cells[slot.cell];
+    Batch& batch = cell.dynamicBatches[slot.batch];
+    const std::size_t last = batch.tiles.size() - 1;
+    if (slot.quad != last) {
+        for (std::size_t v = 0; v < 6; ++v) batch.vertices[slot.quad * 6 + v] = batch.vertices[last * 6 + v];
+        batch.tiles[slot.quad] = batch.tiles[last];
+        m_slots[m_slotOf[batch.tiles[slot.quad]]].quad = slot.quad;
+    }
+    batch.tiles.pop_back();
+    batch.vertices.resize(last * 6);
+    --cell.dynamicQuads;
+    --m_dynamicQuads;
+    slot.cell = NoCell;
+}
+
+bool TileBatchRenderer::isVisible(const Tile& tile) {
+    return tile.getFillColor().a > 0 && !tile.hasFallen();
+}
+
+void TileBatchRenderer::appendQuad(const Tile& tile, sf::VertexArray& vertices) {
+    const std::size_t first = vertices.getVertexCount();
+    vertices.resize(first + 6);
+    writeQuad(tile, vertices, first);
+}
+
+void TileBatchRenderer::writeQuad(const Tile& tile, sf::VertexArray& vertices, std::size_t firstVertex) {
+    const sf::Transform& transform = tile.getTransform();
+    const sf::Vector2f size = tile.getSize();
+    const sf::Vector2f topLeft = transform.transformPoint({0.f, 0.f});
+    const sf::Vector2f topRight = transform.transformPoint({size.x, 0.f});
+    const sf::Vector2f bottomRight = transform.transformPoint(size);
+    const sf::Vector2f bottomLeft = transform.transformPoint({0.f, size.y});
+
+    const sf::FloatRect rect(tile.getTextureRect());
+    const sf::Vector2f uvTopLeft = rect.position;
+    const sf::Vector2f uvTopRight = rect.position + sf::Vector2f(rect.size.x, 0.f);
+    const sf::Vector2f uvBottomRight = rect.position + rect.size;
+    const sf::Vector2f uvBottomLeft = rect.position + sf::Vector2f(0.f, rect.size.y);
+
+    const sf::Color color = tile.getFillColor();
+    vertices[firstVertex + 0] = sf::Vertex{topLeft, color, uvTopLeft};
+    vertices[firstVertex + 1] = sf::Vertex{topRight, color, uvTopRight};
+    vertices[firstVertex + 2] = sf::Vertex{bottomRight, color, uvBottomRight};
+    vertices[firstVertex + 3] = sf::Vertex{topLeft, color, uvTopLeft};
+    vertices[firstVertex + 4] = sf::Vertex{bottomRight, color, uvBottomRight};
+    vertices[firstVertex + 5] = sf::Vertex{bottomLeft, color, uvBottomLeft};
+}
+
+void TileBatchRenderer::bake(Cell& cell) {
+    // only what's visible gets baked, hidden tiles come back in with the next rebake
+    const std::vector<Tile>& tiles = *m_tiles;
+    bool any = false;
+    m_bakedQuads -= cell.quads;
+    cell.quads = 0;
+    for (Batch& batch : cell.batches) {
+        batch.vertices.clear();
+        for (std::size_t index : batch.tiles) {
+            const Tile& tile = tiles[index];
+            if (!isVisible(tile)) continue;
+            appendQuad(tile, batch.vertices);
+            cell.bounds = any ? unite(cell.bounds, tile.getGlobalBounds()) : tile.getGlobalBounds();
+            any = true;
+            ++cell.quads;
+        }
+    }
+    if (!any) cell.bounds = sf::FloatRect();
+    m_bakedQuads += cell.quads;
+    cell.dirty = false;
+    cell.layerStale = true;
+    cell.layerTooBig = false;
+    ++m_stats.rebakes;
+}
+
+bool TileBatchRenderer::prepareLayer(Cell& cell) {
+    if (!m_layersEnabled || cell.layerTooBig) return false;
+    cell.layerUsedFrame = m_frame;
+    if (cell.layer && !cell.layerStale) return true;
+
+    const sf::Vector2u size(static_cast<unsigned int>(std::ceil(cell.bounds.size.x * m_layerScale)),
+                            static_cast<unsigned int>(std::ceil(cell.bounds.size.y * m_layerScale)));
+    const unsigned int maxSize = std::min(4096u, sf::Texture::getMaximumSize());
+    if (size.x == 0 || size.y == 0 || size.x > maxSize || size.y > maxSize) {
+        dropLayer(cell);
+        cell.layerTooBig = true;
+        return false;
+    }
+    if (!cell.layer) {
+        cell.layer = std::make_unique<sf::RenderTexture>();
+        m_layerCells.push_back(static_cast<std::size_t>(&cell - m_cells.data()));
+    }
+    if (cell.layer->getSize() != size && !cell.layer->resize(size)) {
+        dropLayer(cell);
+        cell.layerTooBig = true; // no render textures on this machine (or no memory), don't retry every frame
+        return false;
+    }
+
+    cell.layer->setView(sf::View(cell.bounds));
+    cell.layer->clear(sf::Color::Transparent);
+    for (const Batch& batch : cell.batches) {
+        if (batch.vertices.getVertexCount() == 0) continue;
+        cell.layer->draw(batch.vertices, sf::RenderStates(batch.texture));
+    }
+    cell.layer->display();
+    cell.layerStale = false;
+    ++m_stats.layerRenders;
+
+    const sf::Vector2f topLeft = cell.bounds.position;
+    const sf::Vector2f bottomRight = cell.bounds.position + cell.bounds.size;
+    const sf::Vector2f texels(static_cast<float>(size.x), static_cast<float>(size.y));
+    cell.layerQuad.clear();
+    cell.layerQuad.append(sf::Vertex{topLeft, sf::Color::White, {0.f, 0.f}});
+    cell.layerQuad.append(sf::Vertex{{bottomRight.x, topLeft.y}, sf::Color::White, {texels.x, 0.f}});
+    cell.layerQuad.append(sf::Vertex{bottomRight, sf::Color::White, texels});
+    cell.layerQuad.append(sf::Vertex{topLeft, sf::Color::White, {0.f, 0.f}});
+    cell.layerQuad.append(sf::Vertex{bottomRight, sf::Color::White, texels});
+    cell.layerQuad.append(sf::Vertex{{topLeft.x, bottomRight.y}, sf::Color::White, {0.f, texels.y}});
+    return true;
+}
+
+void TileBatchRenderer::dropLayer(Cell& cell) {
+    cell.layer.reset();
+    cell.layerStale = true;
+    cell.layerQuad.clear();
+}
+
+void TileBatchRenderer::trimLayers() {
+    m_layerCells.erase(std::remove_if(m_layerCells.begin(), m_layerCells.end(), [this](std::size_t c) { return !m_cells[c].layer; }), m_layerCells.end());
+    if (m_layerCells.size() > m_maxLayers) {
+        // least recently drawn first. nth_element keeps this linear in the number of layers
+        const std::size_t excess = m_layerCells.size() - m_maxLayers;
+        std::nth_element(m_layerCells.begin(), m_layerCells.begin() + excess, m_layerCells.end(),
+                         [this](std::size_t a, std::size_t b) { return m_cells[a].layerUsedFrame < m_cells[b].layerUsedFrame; });
+        for (std::size_t i = 0; i < excess; ++i) dropLayer(m_cells[m_layerCells[i]]);
+        m_layerCells.erase(m_layerCells.begin(), m_layerCells.begin() + excess);
+    }
+    m_stats.layers = m_layerCells.size();
+    m_stats.layerBytes = 0;
+    for (std::size_t c : m_layerCells) {
+        const sf::Vector2u size = m_cells[c].layer->getSize();
+        m_stats.layerBytes += std::size_t(size.x) * size.y * 4;
+    }
+}
+
+void TileBatchRenderer::update(const sf::FloatRect& viewBounds) {
+    m_stats.drawCalls = 0;
+    m_stats.vertices = 0;
+    m_stats.drawnTiles = 0;
+    m_stats.culledTiles = 0;
+    m_drawList.clear();
+    m_dynamicDrawCells.clear();
+    if (!m_tiles) return;
+    ++m_frame;
+
+    auto submit = [this](const sf::VertexArray& vertices, const sf::Texture* texture, bool premultiplied) {
+        if (vertices.getVertexCount() == 0) return;
+        m_drawList.push_back(DrawItem{&vertices, texture, premultiplied});
+        ++m_stats.drawCalls;
+        m_stats.vertices += vertices.getVertexCount();
+    };
+
+    // dirty cells are baked wherever they are, so the culled count stays honest for cells nobody looks at
+    for (std::size_t c : m_dirtyCells) bake(m_cells[c]);
+    m_dirtyCells.clear();
+
+    // grid cells under the view, widened by the biggest tile so ones hanging in from a neighbouring cell aren't missed
+    const float margin = std::max(m_maxTileExtent, m_maxDynamicExtent);
+    const int minX = static_cast<int>(std::floor((viewBounds.position.x - margin) / m_cellSize));
+    const int minY = static_cast<int>(std::floor((viewBounds.position.y - margin) / m_cellSize));
+    const int maxX = static_cast<int>(std::floor((viewBounds.position.x + viewBounds.size.x) / m_cellSize));
+    const int maxY = static_cast<int>(std::floor((viewBounds.position.y + viewBounds.size.y) / m_cellSize));
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            auto it = m_cellAt.find(cellKey(x, y));
+            if (it == m_cellAt.end()) continue;
+            Cell& cell = m_cells[it->second];
+            // dynamic quads have no baked bounds, their tiles start inside the cell and reach at most one extent out
+            const sf::FloatRect dynamicArea({x * m_cellSize, y * m_cellSize}, {m_cellSize + m_maxDynamicExtent, m_cellSize + m_maxDynamicExtent});
+            if (cell.dynamicQuads > 0 && overlaps(dynamicArea, viewBounds)) m_dynamicDrawCells.push_back(it->second);
+            if (cell.quads == 0 || !overlaps(cell.bounds, viewBounds)) continue;
+            if (prepareLayer(cell)) {
+                submit(cell.layerQuad, &cell.layer->getTexture(), true);
+            } else {
+                for (const Batch& batch : cell.batches) submit(batch.vertices, batch.texture, false);
+            }
+            m_stats.drawnTiles += cell.quads;
+        }
+    }
+
+    // the vertices are already current (applyChanges), they only go in after every static batch so moving
+    // platforms stay on top like they did with one array per texture
+    for (std::size_t c : m_dynamicDrawCells) {
+        const Cell& cell = m_cells[c];
+        for (const Batch& batch : cell.dynamicBatches) submit(batch.vertices, batch.texture, false);
+        m_stats.drawnTiles += cell.dynamicQuads;
+    }
+    m_stats.culledTiles = m_bakedQuads + m_dynamicQuads - m_stats.drawnTiles;
+    trimLayers();
+}
+
+void TileBatchRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    const sf::BlendMode blendMode = states.blendMode;
+    for (const DrawItem& item : m_drawList) {
+        states.texture = item.texture;
+        states.blendMode = item.premultiplied ? BlendPremultiplied : blendMode;
+        target.draw(*item.vertices, states);
+    }
+}
@@ -0,0 +1,24 @@
+#include "TileChangeList.hpp"
+
+void TileChangeList::reset(std::size_t tileCount) {
+    m_flags.assign(tileCount, 0);
+    m_changed.clear();
+}
+
+void TileChangeList::mark(std::size_t tileIndex, std::uint8_t changes) {
+    if (changes == 0) return;
+    ++m_tickChanges;
+    if (tileIndex >= m_flags.size()) m_flags.resize(tileIndex + 1, 0);
+    if (m_flags[tileIndex] == 0) m_changed.push_back(tileIndex);
+    m_flags[tileIndex] |= changes;
+}
+
+void TileChangeList::clear() {
+    for (std::size_t index : m_changed) m_flags[index] = 0;
+    m_changed.clear();
+}
+
+void TileChangeList::endTick() {
+    m_lastTickChanges = m_tickChanges;
+    m_tickChanges = 0;
+}
@@ -0,0 +1,217 @@
+// collisionbench: headless timing of the collision hot path, no window and no level files
+// usage: collisionbench [--runs N] [--bodies N ...] [--dynamic N] [--threads N ...]
+// narrowphase: the candidate filter pass (type check + strict overlap against the swept box) over every platform,
+// once reading PlatformBody objects the way the solver did before CollisionWorld (aos), once the packed arrays (soa)
+// both loops do the exact same math and must agree on the survivor count, only where the data comes from differs
+// batch resolve: the multi-body resolveCollisions over a pile of falling/running bodies on 1, 2, 4 and every hardware
+// thread (1 = the single-body overload in a loop), results have to match the single threaded run exactly
+#include "CollisionSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // a level-ish scatter: mostly plain platforms, the odd trigger, a few conveyors
+    std::vector<phys::PlatformBody> makeBodies(std::size_t count, std::uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coordinate(-20000.f, 20000.f);
+        std::uniform_real_distribution<float> extent(16.f, 256.f);
+        std::uniform_int_distribution<int> kind(0, 9);
+        std::vector<phys::PlatformBody> bodies;
+        bodies.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            phys::bodyType type = phys::bodyType::solid;
+            switch (kind(rng)) {
+                case 0: type = phys::bodyType::platform; break;
+                case 1: type = phys::bodyType::conveyorBelt; break;
+                case 2: type = phys::bodyType::trap; break;
+                default: break;
+            }
+            bodies.emplace_back(static_cast<unsigned int>(i), sf::Vector2f{coordinate(rng), coordinate(rng)},
+                                extent(rng), extent(rng), type, false, sf::Vector2f{0.f, 0.f}, "solid platform.png");
+        }
+        return bodies;
+    }
+
+    struct Box { float minX, minY, maxX, maxY; };
+
+    bool overlaps(const Box& box, float minX, float minY, float maxX, float maxY) {
+        return std::max(box.minX, minX) < std::min(box.maxX, maxX) && std::max(box.minY, minY) < std::min(box.maxY, maxY);
+    }
+
+    // what the narrowphase read per candidate before CollisionWorld: type, position and size out of the PlatformBody
+    std::size_t filterAoS(const std::vector<phys::PlatformBody>& bodies, const Box& swept) {
+        std::size_t survivors = 0;
+        for (const phys::PlatformBody& platform : bodies) {
+            if (!(phys::CollisionWorld::flagsFor(platform.getType()) & phys::CollisionWorld::Collidable)) continue;
+            const sf::Vector2f& position = platform.getPosition();
+            if (overlaps(swept, position.x, position.y, position.x + platform.getWidth(), position.y + platform.getHeight())) ++survivors;
+        }
+        return survivors;
+    }
+
+    std::size_t filterSoA(const phys::CollisionWorld& world, const Box& swept) {
+        std::size_t survivors = 0;
+        for (std::size_t i = 0; i < world.size(); ++i) {
+            if (!(world.flags(i) & phys::CollisionWorld::Collidable)) continue;
+            if (overlaps(swept, world.minX(i), world.minY(i), world.maxX(i), world.maxY(i))) ++survivors;
+        }
+        return survivors;
+    }
+
+    // best of runs, in ns per body. the swept box walks around so nothing gets hoisted out of the loop
+    template <typename Pass>
+    double bestNsPerBody(int runs, std::size_t count, std::size_t& survivors, Pass&& pass) {
+        double best = 1e30;
+        for (int run = 0; run < runs; ++run) {
+            const float offset = static_cast<float>(run % 16) * 500.f;
+            const Box swept{-4000.f + offset, -4000.f, 4000.f + offset, 4000.f};
+            const auto start = Clock::now();
+            survivors = pass(swept);
+            const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            best = std::min(best, ns / static_cast<double>(count));
+        }
+        return best;
+    }
+
+    // a tiled floor with ledges above it, the dynamic bodies rain down on it with some sideways speed
+    std::vector<phys::PlatformBody> makeLevel(std::uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> ledgeX(0.f, 16000.f);
+        std::uniform_real_distribution<float> ledgeY(-2000.f, 900.f);
+        std::uniform_real_distribution<float> ledgeWidth(64.f, 400.f);
+        std::vector<phys::PlatformBody> platforms;
+        for (int i = 0; i < 500; ++i) {
+            platforms.emplace_back(static_cast<unsigned int>(platforms.size()), sf::Vector2f{i * 32.f, 1000.f}, 32.f, 32.f, phys::bodyType::solid);
+        }
+        for (int i = 0; i < 3000; ++i) {
+            const phys::bodyType type = i % 4 == 0 ? phys::bodyType::platform : phys::bodyType::solid;
+            platforms.emplace_back(static_cast<unsigned int>(platforms.size()), sf::Vector2f{ledgeX(rng), ledgeY(rng)},
+                                   ledgeWidth(rng), 24.f, type);
+        }
+        return platforms;
+    }
+
+    std::vector<phys::DynamicBody> makeDynamicBodies(std::size_t count, std::uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> x(0.f, 16000.f);
+        std::uniform_real_distribution<float> y(-2500.f, 950.f);
+        std::uniform_real_distribution<float> vx(-400.f, 400.f);
+        std::uniform_real_distribution<float> vy(-300.f, 900.f);
+        std::vector<phys::DynamicBody> bodies;
+        bodies.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) bodies.emplace_back(sf::Vector2f{x(rng), y(rng)}, 32.f, 48.f, sf::Vector2f{vx(rng), vy(rng)});
+        return bodies;
+    }
+
+    bool sameResults(const std::vector<phys::DynamicBody>& a, const std::vector<phys::DynamicBody>& b) {
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i].getPosition() != b[i].getPosition() || a[i].getVelocity() != b[i].getVelocity() || a[i].isOnGround() != b[i].isOnGround()) return false;
+        }
+        return true;
+    }
+
+    // best of runs in ms for one tick of every body, each run starts from the same copy of the bodies
+    int benchBatchResolve(int runs, std::size_t dynamicCount, std::vector<std::size_t> threadCounts) {
+        const float TICK = 1.f / 60.f;
+        const std::vector<phys::PlatformBody> platforms = makeLevel(42u);
+        phys::CollisionWorld world;
+        world.rebuild(platforms);
+        phys::DynamicAABBTree tree;
+        tree.build(platforms);
+        const std::vector<phys::DynamicBody> initial = makeDynamicBodies(dynamicCount, 7u);
+
+        std::vector<phys::DynamicBody> reference = initial;
+        for (phys::DynamicBody& body : reference) phys::CollisionSystem::resolveCollisions(body, world, tree, TICK);
+
+        std::cout << "batch resolve, " << dynamicCount << " bodies vs " << platforms.size() << " platforms, best of " << runs
+                  << " runs, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        double serialMs = 0.0;
+        for (std::size_t threads : threadCounts) {
+            std::unique_ptr<ThreadPool> pool;
+            if (threads > 1) pool = std::make_unique<ThreadPool>(threads - 1); // the calling thread is the last one
+            double best = 1e30;
+            std::vector<phys::DynamicBody> bodies;
+            for (int run = 0; run < runs; ++run) {
+                bodies = initial;
+                const auto start = Clock::now();
+                if (pool) {
+                    phys::CollisionSystem::resolveCollisions(bodies, world, tree, TICK, *pool);
+                } else {
+                    for (phys::DynamicBody& body : bodies) phys::CollisionSystem::resolveCollisions(body, world, tree, TICK);
+                }
+                best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            }
+            if (!sameResults(bodies, reference)) {
+                std::cerr << "collisionbench: " << threads << " threads resolved differently than 1" << std::endl;
+                return 1;
+            }
+            if (threads == 1) serialMs = best;
+            std::cout << "  " << threads << " threads: " << best << " ms, " << static_cast<double>(dynamicCount) / best
+                      << " bodies/ms";
+            if (serialMs > 0.0) std::cout << ", " << serialMs / best << "x";
+            std::cout << std::endl;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = 50;
+    std::vector<std::size_t> sizes;
+    std::size_t dynamicCount = 4096;
+    std::vector<std::size_t> threadCounts;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--bodies" && i + 1 < argc) {
+            sizes.push_back(static_cast<std::size_t>(std::max(1, std::atoi(argv[++i]))));
+        } else if (arg == "--dynamic" && i + 1 < argc) {
+            dynamicCount = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threadCounts.push_back(static_cast<std::size_t>(std::max(1, std::atoi(argv[++i]))));
+        } else {
+            std::cerr << "usage: collisionbench [--runs N] [--bodies N ...] [--dynamic N] [--threads N ...]" << std::endl;
+            return 1;
+        }
+    }
+    // in cache, about l2, well past l3
+    if (sizes.empty()) sizes = {1000, 20000, 1000000};
+    if (threadCounts.empty()) {
+        threadCounts = {1, 2, 4, std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+    }
+    // 1 first, it's the reference the others get compared against
+    threadCounts.push_back(1);
+    std::sort(threadCounts.begin(), threadCounts.end());
+    threadCounts.erase(std::unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+
+    std::cout << "narrowphase filter, best of " << runs << " runs" << std::endl;
+    std::cout << "  bytes per body: aos " << sizeof(phys::PlatformBody) << " (whole PlatformBody), soa "
+              << phys::CollisionWorld::HOT_BYTES_PER_BODY << " (bounds + flags)" << std::endl;
+    for (std::size_t count : sizes) {
+        const std::vector<phys::PlatformBody> bodies = makeBodies(count, 1234u);
+        phys::CollisionWorld world;
+        world.rebuild(bodies);
+
+        std::size_t aosSurvivors = 0;
+        std::size_t soaSurvivors = 0;
+        const double aos = bestNsPerBody(runs, count, aosSurvivors, [&bodies](const Box& swept) { return filterAoS(bodies, swept); });
+        const double soa = bestNsPerBody(runs, count, soaSurvivors, [&world](const Box& swept) { return filterSoA(world, swept); });
+        if (aosSurvivors != soaSurvivors) {
+            std::cerr << "collisionbench: aos and soa disagree (" << aosSurvivors << " vs " << soaSurvivors << ")" << std::endl;
+            return 1;
+        }
+        std::cout << "  " << count << " bodies: aos " << aos << " ns/body, soa " << soa << " ns/body, "
+                  << aos / soa << "x" << std::endl;
+    }
+    return benchBatchResolve(runs, dynamicCount, threadCounts);
+}
@@ -0,0 +1,110 @@
+// levelc: compiles levelN.json into the levelN.bin blob LevelManager maps at load time
+// usage: levelc [--runs N] [--synthetic PLATFORMS] level1.json [level2.json ...]
+// every json gets a .bin next to it, then both are loaded N times and the average load time is printed
+// --synthetic writes a made up level with that many platforms to the temp dir first, for parser throughput numbers
+#include "LevelManager.hpp"
+#include "LevelBinary.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename Fn>
+    double averageMs(int runs, Fn&& load) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            if (!load()) return -1.0;
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+    }
+
+    // every platform kind and every optional block the parser knows about, so no branch of it gets skipped
+    std::string writeSyntheticLevel(int platformCount) {
+        const std::string path = (std::filesystem::temp_directory_path() / ("levelc_synthetic_" + std::to_string(platformCount) + ".json")).string();
+        std::ofstream out(path);
+        out << "{\n  \"levelName\": \"Synthetic " << platformCount << "\",\n  \"levelNumber\": 0,\n"
+            << "  \"playerStart\": { \"x\": 150, \"y\": 400 },\n  \"backgroundColor\": { \"r\": 20, \"g\": 20, \"b\": 40 },\n"
+            << "  \"backgroundTexture\": \"LEVEL_ONE_BACKGROUND.png\",\n  \"platforms\": [\n";
+        for (int i = 0; i < platformCount; ++i) {
+            const int x = (i % 200) * 64;
+            const int y = (i / 200) * -48;
+            out << "    { \"id\": " << i + 1 << ", \"position\": { \"x\": " << x << ", \"y\": " << y << " }, "
+                << "\"size\": { \"width\": 64, \"height\": 32 }, \"texture\": \"tile" << i % 16 << ".png\", "
+                << "\"dimensions\": {\"top-left-x\": 0, \"top-left-y\": 0, \"bottom-right-x\": 64, \"bottom-right-y\": 32}, ";
+            switch (i % 4) {
+                case 0: out << "\"type\": \"solid\""; break;
+                case 1: out << "\"type\": \"moving\", \"movement\": { \"axis\": \"x\", \"distance\": 200.5, \"cycleDuration\": 4, \"initialDirection\": -1 }"; break;
+                case 2: out << "\"type\": \"portal\", \"portalID\": " << i / 2 << ", \"teleportOffset\": { \"x\": 10, \"y\": 0 }"; break;
+                default: out << "\"type\": \"interactible\", \"interaction\": { \"type\": \"changeSelf\", \"targetBodyType\": \"solid\", "
+                             << "\"targetTileColor\": { \"r\": 200, \"g\": 50, \"b\": 50 }, \"oneTime\": true, \"cooldown\": 0.5 }"; break;
+            }
+            out << " }" << (i + 1 < platformCount ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+        return out ? path : std::string();
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = 20;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--synthetic" && i + 1 < argc) {
+            const std::string path = writeSyntheticLevel(std::max(1, std::atoi(argv[++i])));
+            if (path.empty()) {
+                std::cerr << "levelc: could not write the synthetic level" << std::endl;
+                return 1;
+            }
+            inputs.push_back(path);
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+    if (inputs.empty()) {
+        std::cerr << "usage: levelc [--runs N] [--synthetic PLATFORMS] level1.json [level2.json ...]" << std::endl;
+        return 1;
+    }
+
+    LevelManager levelManager;
+    int failures = 0;
+    for (const std::string& jsonPath : inputs) {
+        const std::string binaryPath = std::filesystem::path(jsonPath).replace_extension(".bin").string();
+        if (!levelManager.compileLevel(jsonPath, binaryPath)) {
+            ++failures;
+            continue;
+        }
+
+        LevelData levelData;
+        std::vector<std::string> texturePaths;
+        const double jsonMs = averageMs(runs, [&]() { return levelManager.loadLevelFromJson(jsonPath, levelData, texturePaths); });
+        const double binaryMs = averageMs(runs, [&]() { return LevelBinary::load(binaryPath, levelData, texturePaths); });
+        if (jsonMs < 0.0 || binaryMs < 0.0) {
+            std::cerr << "levelc: " << binaryPath << " does not load back" << std::endl;
+            ++failures;
+            continue;
+        }
+
+        // streamed levels come back with their platforms left in the file, per chunk
+        std::size_t platformCount = levelData.platforms.size();
+        for (const LevelData::Chunk& chunk : levelData.chunks) platformCount += chunk.platformCount;
+
+        std::error_code ec;
+        const auto jsonBytes = std::filesystem::file_size(jsonPath, ec);
+        const auto binaryBytes = std::filesystem::file_size(binaryPath, ec);
+        std::cout << jsonPath << " -> " << binaryPath << "  "
+                  << platformCount << " platforms, " << texturePaths.size() << " textures, "
+                  << jsonBytes << " -> " << binaryBytes << " bytes | json " << jsonMs << " ms, binary " << binaryMs << " ms";
+        if (jsonMs > 0.0) std::cout << " (json " << (static_cast<double>(jsonBytes) / (1024.0 * 1024.0)) / (jsonMs / 1000.0) << " MB/s)";
+        if (binaryMs > 0.0) std::cout << " (" << jsonMs / binaryMs << "x)";
+        std::cout << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+// levelstat: loads levels the way the game does, minus the window, and reports what's in them and where the load time goes
+// usage: levelstat [--runs N] [--levels DIR] [--warm] [--no-upload] [1 2 ...]
+// no level numbers = every levelN.json in the directory. the report is json on stdout, LevelManager's log goes to stderr
+// runs are cold by default (texture cache emptied in between) so decode and upload get measured every time
+// --no-upload stops after decoding, for machines that can't make a gl context
+#include "LevelManager.hpp"
+#include "LevelBinary.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    const char* bodyTypeName(phys::bodyType type) {
+        switch (type) {
+            case phys::bodyType::none:         return "none";
+            case phys::bodyType::platform:     return "platform";
+            case phys::bodyType::conveyorBelt: return "conveyorBelt";
+            case phys::bodyType::moving:       return "moving";
+            case phys::bodyType::interactible: return "interactible";
+            case phys::bodyType::falling:      return "falling";
+            case phys::bodyType::vanishing:    return "vanishing";
+            case phys::bodyType::spring:       return "spring";
+            case phys::bodyType::trap:         return "trap";
+            case phys::bodyType::solid:        return "solid";
+            case phys::bodyType::goal:         return "goal";
+            case phys::bodyType::portal:       return "portal";
+        }
+        return "unknown";
+    }
+
+    std::string quoted(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20) continue;
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // min / median / mean of one phase over every run
+    std::string phaseJson(std::vector<double> samples) {
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (double sample : samples) sum += sample;
+        const std::size_t n = samples.size();
+        const double median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2.0;
+        return "{\"min\": " + std::to_string(samples.front()) + ", \"median\": " + std::to_string(median) +
+               ", \"mean\": " + std::to_string(sum / static_cast<double>(n)) + "}";
+    }
+
+    std::vector<int> levelsInDirectory(const std::string& directory) {
+        std::vector<int> levels;
+        const std::regex levelFile("level([0-9]+)\\.json");
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+            std::smatch match;
+            const std::string name = entry.path().filename().string();
+            if (std::regex_match(name, match, levelFile)) levels.push_back(std::atoi(match[1].str().c_str()));
+        }
+        std::sort(levels.begin(), levels.end());
+        return levels;
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = 10;
+    bool warm = false;
+    bool upload = true;
+    std::string directory = "../assets/levels/";
+    std::vector<int> levels;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--levels" && i + 1 < argc) {
+            directory = argv[++i];
+            if (!directory.empty() && directory.back() != '/') directory += '/';
+        } else if (arg == "--warm") {
+            warm = true;
+        } else if (arg == "--no-upload") {
+            upload = false;
+        } else if (std::atoi(arg.c_str()) > 0) {
+            levels.push_back(std::atoi(arg.c_str()));
+        } else {
+            std::cerr << "usage: levelstat [--runs N] [--levels DIR] [--warm] [--no-upload] [1 2 ...]" << std::endl;
+            return 1;
+        }
+    }
+    if (levels.empty()) levels = levelsInDirectory(directory);
+    if (levels.empty()) {
+        std::cerr << "levelstat: no levelN.json in " << directory << std::endl;
+        return 1;
+    }
+
+    // the report owns stdout, everything LevelManager prints while loading goes to stderr
+    std::ostream report(std::cout.rdbuf());
+    std::cout.rdbuf(std::cerr.rdbuf());
+
+    LevelManager levelManager;
+    levelManager.setLevelBasePath(directory);
+    TextureCache& textureCache = levelManager.getTextureCache();
+    const std::size_t textureBudget = textureCache.getByteBudget();
+
+    int failures = 0;
+    report << "{\n  \"runs\": " << runs << ",\n  \"cold\": " << (warm ? "false" : "true") << ",\n  \"upload\": " << (upload ? "true" : "false")
+           << ",\n  \"levels\": [";
+    bool firstLevel = true;
+    for (int levelNumber : levels) {
+        std::vector<LevelManager::LoadProfile> profiles;
+        LevelData levelData;
+        for (int run = 0; run < runs; ++run) {
+            levelData = LevelData();
+            if (!warm) {
+                // nothing holds the last run's textures anymore, a zero budget drops every one of them
+                textureCache.setByteBudget(0);
+                textureCache.trim();
+                textureCache.setByteBudget(textureBudget);
+            }
+            LevelManager::LoadProfile profile;
+            if (!levelManager.loadLevelNow(levelNumber, levelData, &profile, upload)) break;
+            profiles.push_back(profile);
+        }
+        if (profiles.size() != static_cast<std::size_t>(runs)) {
+            std::cerr << "levelstat: level " << levelNumber << " failed to load" << std::endl;
+            ++failures;
+            continue;
+        }
+
+        std::map<std::string, std::size_t> byType;
+        std::set<std::string> textures;
+        std::size_t platformCount = 0;
+        auto countPlatforms = [&](const std::vector<phys::PlatformBody>& platforms) {
+            for (const phys::PlatformBody& platform : platforms) {
+                ++byType[bodyTypeName(platform.getType())];
+                if (!platform.getTexturePath().empty()) textures.insert(platform.getTexturePath());
+            }
+            platformCount += platforms.size();
+        };
+        countPlatforms(levelData.platforms);
+        // a streamed level keeps its platforms in the chunks, a compiled one only has them in the file
+        std::vector<phys::PlatformBody> chunkPlatforms;
+        std::map<int, sf::IntRect> chunkDimensions;
+        for (std::size_t chunk = 0; chunk < levelData.chunks.size(); ++chunk) {
+            if (!levelData.chunkFile) {
+                countPlatforms(levelData.chunks[chunk].platforms);
+            } else if (levelData.chunkFile->readChunk(chunk, chunkPlatforms, chunkDimensions)) {
+                countPlatforms(chunkPlatforms);
+            }
+        }
+        if (!levelData.backgroundTexturePath.empty()) textures.insert(levelData.backgroundTexturePath);
+
+        const LevelManager::LoadProfile& last = profiles.back();
+        auto phase = [&profiles](double LevelManager::LoadProfile::*field) {
+            std::vector<double> samples;
+            samples.reserve(profiles.size());
+            for (const LevelManager::LoadProfile& profile : profiles) samples.push_back(profile.*field);
+            return phaseJson(std::move(samples));
+        };
+
+        report << (firstLevel ? "\n" : ",\n") << "    {\n"
+               << "      \"level\": " << levelNumber << ",\n"
+               << "      \"name\": " << quoted(levelData.levelName) << ",\n"
+               << "      \"source\": \"" << (last.fromBinary ? "binary" : "json") << "\",\n"
+               << "      \"fileBytes\": " << last.fileBytes << ",\n"
+               << "      \"platforms\": " << platformCount << ",\n"
+               << "      \"platformsByType\": {";
+        bool firstType = true;
+        for (const auto& [type, count] : byType) {
+            report << (firstType ? "" : ", ") << quoted(type) << ": " << count;
+            firstType = false;
+        }
+        report << "},\n"
+               << "      \"movingPlatforms\": " << levelData.movingPlatformDetails.size() << ",\n"
+               << "      \"interactiblePlatforms\": " << levelData.interactiblePlatformDetails.size() << ",\n"
+               << "      \"portalPlatforms\": " << levelData.portalPlatformDetails.size() << ",\n"
+               << "      \"animatedPlatforms\": " << levelData.animationDetails.size() << ",\n"
+               << "      \"chunks\": " << levelData.chunks.size() << ",\n"
+               << "      \"uniqueTextures\": " << textures.size() << ",\n"
+               << "      \"texturesLoaded\": " << last.texturesLoaded << ",\n"
+               << "      \"texturesDecoded\": " << last.texturesDecoded << ",\n"
+               << "      \"decodedTextureBytes\": " << last.decodedBytes << ",\n"
+               << "      \"phasesMs\": {\n"
+               << "        \"read\": " << phase(&LevelManager::LoadProfile::readMs) << ",\n"
+               << "        \"parse\": " << phase(&LevelManager::LoadProfile::parseMs) << ",\n"
+               << "        \"chunk\": " << phase(&LevelManager::LoadProfile::chunkMs) << ",\n"
+               << "        \"decode\": " << phase(&LevelManager::LoadProfile::decodeMs) << ",\n"
+               << "        \"upload\": " << phase(&LevelManager::LoadProfile::uploadMs) << ",\n"
+               << "        \"atlas\": " << phase(&LevelManager::LoadProfile::atlasMs) << ",\n"
+               << "        \"total\": " << phase(&LevelManager::LoadProfile::totalMs) << "\n"
+               << "      }\n    }";
+        firstLevel = false;
+    }
+    report << "\n  ]\n}" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
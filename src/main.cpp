@@ -11,12 +11,19 @@
 #include <limits>
 #include <filesystem>
 #include <map>
+#include <chrono>
 #include "CollisionSystem.hpp"
+#include "DynamicAABBTree.hpp"
+#include "CollisionWorld.hpp"
 #include "Player.hpp"
 #include "PlatformBody.hpp"
 #include "Tile.hpp"
+#include "TileBatchRenderer.hpp"
+#include "TileChangeList.hpp"
 #include "PhysicsTypes.hpp"
 #include "LevelManager.hpp"
+#include "AssetRegistry.hpp"
+#include "LevelRuntime.hpp"
 #include "Optimizer.hpp"
 
 enum class GameState {
@@ -42,16 +49,69 @@ std::vector<sf::VideoMode> availableVideoModes;
 int currentResolutionIndex = 0;
 bool isFullscreen = true;
 
-sf::Font defaultFont("../assets/fonts/ARIALBD.TTF");
-sf::Text resolutionCurrentText(defaultFont);
 void updateResolutionDisplayText();
 
 // --- Global Game Objects ---
 LevelManager levelManager;
+AssetRegistry assets(levelManager.getTextureCache()); // fonts, sounds and every texture that isn't a level's
 LevelData currentLevelData;
+LevelRuntime levelRuntime; // id -> index and per-behavior index lists for the running level
 phys::DynamicBody playerBody;
 std::vector<phys::PlatformBody> bodies;
 std::vector<Tile> tiles;
+// bodies[i] came from currentLevelData.platforms[i], unless the level is streamed. then only the resident chunks' platforms
+// have a body, each chunk in its own run of slots (see chunkBodies), and bodyChunks[i] is the chunk body i belongs to
+std::vector<std::size_t> bodyChunks;
+// streamed levels, per LevelData::chunks: the body (and tile) slots [first, first + count) a resident chunk's platforms
+// sit in, in the chunk's order. count is 0 while the chunk is out, slots it gave back hold an inert body and a blank tile
+struct ChunkBodies {
+    std::size_t first = 0;
+    std::size_t count = 0;
+};
+std::vector<ChunkBodies> chunkBodies;
+TileBatchRenderer tileBatches; // what actually draws tiles, see rebuildTileBatches
+TileChangeList tileChanges;    // tiles gameplay touched since the last frame, tileBatches applies them before drawing
+sprites::SpriteManager spriteManager; // the running level's tile animations
+const float PLATFORM_TREE_FAT_MARGIN = 16.f;
+phys::DynamicAABBTree platformTree(PLATFORM_TREE_FAT_MARGIN);
+std::vector<phys::TriggerHit> triggerHits; // every trigger the player touches this tick, filled once after collision resolution
+phys::CollisionWorld collisionWorld; // packed bounds/flags the solver reads, bodies stays the gameplay copy
+std::size_t lastNarrowphaseTests = 0;
+std::size_t restingFastTicks = 0; // solver ticks answered from the player's contact cache, per level
+std::size_t fullSolveTicks = 0;
+
+// every runtime reposition of a platform goes through here so its broadphase leaf and solver data stay in sync
+void moveBody(std::size_t bodyIndex, const sf::Vector2f& position) {
+    bodies[bodyIndex].setPosition(position);
+    platformTree.updateBody(bodyIndex, bodies[bodyIndex].getAABB());
+    collisionWorld.sync(bodyIndex);
+}
+
+// same deal for type changes, the solver filters on the packed flags
+void setBodyType(std::size_t bodyIndex, phys::bodyType type) {
+    bodies[bodyIndex].setType(type);
+    collisionWorld.sync(bodyIndex);
+}
+
+// tile writes from gameplay go through these, only a real change is written and lands in tileChanges
+void setTilePosition(std::size_t tileIndex, const sf::Vector2f& position) {
+    if (tiles[tileIndex].getPosition() == position) return;
+    tiles[tileIndex].setPosition(position);
+    tileChanges.mark(tileIndex, TileChangeList::Position);
+}
+
+void setTileColor(std::size_t tileIndex, const sf::Color& color) {
+    if (tiles[tileIndex].getFillColor() == color) return;
+    tiles[tileIndex].setFillColor(color);
+    tileChanges.mark(tileIndex, TileChangeList::Color);
+}
+
+// the body as the level file has it, what falling/vanishing/linked platforms go back to
+const phys::PlatformBody& templateOf(std::size_t bodyIndex) {
+    if (chunkBodies.empty()) return currentLevelData.platforms[bodyIndex];
+    const std::size_t chunk = bodyChunks[bodyIndex];
+    return levelManager.getStreamer().getChunkPlatforms(chunk)[bodyIndex - chunkBodies[chunk].first];
+}
 
 struct ActiveMovingPlatform {
     unsigned int id;
@@ -62,6 +122,7 @@ struct ActiveMovingPlatform {
     float cycleDuration;
     int initialDirection;
     sf::Vector2f lastFrameActualPosition;
+    std::size_t bodyIndex;
 };
 std::vector<ActiveMovingPlatform> activeMovingPlatforms;
 
@@ -86,9 +147,9 @@ GameSettings gameSettings;
 
 sf::Music menuMusic;
 sf::Music gameMusic;
-std::map<std::string, sf::SoundBuffer> soundBuffers;
-sf::SoundBuffer defaultSoundBuffer("../assets/audio/default.wav");
-sf::Sound sfxPlayer(defaultSoundBuffer);
+std::map<std::string, SoundBufferHandle> soundBuffers;
+SoundBufferHandle defaultSoundBuffer = assets.soundBuffer("../assets/audio/default.wav");
+sf::Sound sfxPlayer(*defaultSoundBuffer);
 
 // --- Asset Paths ---
 const std::string FONT_PATH = "../assets/fonts/ARIALBD.TTF";
@@ -105,11 +166,13 @@ const std::string SFX_CLICK = "../assets/audio/sfx_click.wav";
 const std::string SFX_SPRING = "../assets/audio/sfx_spring.wav";
 const std::string SFX_PORTAL = "../assets/audio/sfx_portal.wav";
 
+sf::Text resolutionCurrentText(*assets.font(FONT_PATH));
+
 // Sprites
-std::map<int, sf::Texture> LevelBackgrounds;
+std::shared_ptr<sf::Texture> levelBackground; // current level's LEVEL_BG_ID texture, owned by the texture cache
 // PLAYER SPRITE LOADING (basic functionality, to be replaced later)
 const std::string playerCharacterTexturePath = "../assets/sprites/PlayerChar.png";
-sf::Texture playerTexture(playerCharacterTexturePath);
+TextureHandle playerTexture = assets.texture(playerCharacterTexturePath);
 
 // --- Function to populate available resolutions ---
 void populateAvailableResolutions() {
@@ -217,7 +280,7 @@ sf::FloatRect viewportRect({viewportX, viewportY}, {viewportWidthRatio, viewport
 void playSfx(const std::string& sfxName) {
     auto it = soundBuffers.find(sfxName);
     if (it != soundBuffers.end()) {
-        sfxPlayer.setBuffer(it->second);
+        sfxPlayer.setBuffer(*it->second);
         sfxPlayer.setVolume(gameSettings.sfxVolume);
         sfxPlayer.play();
     } else {
@@ -235,8 +298,8 @@ if (!gameMusic.openFromFile(AUDIO_MUSIC_GAME))
 else gameMusic.setLooping(true);
 
     auto loadSfxBuffer = [&](const std::string& name, const std::string& path) {
-        sf::SoundBuffer buffer;
-        if (buffer.loadFromFile(path)) {
+        SoundBufferHandle buffer = assets.soundBuffer(path);
+        if (!buffer.isFallback()) {
             soundBuffers[name] = buffer;
         } else {
             std::cerr << "Error loading SFX: " << path << std::endl;
@@ -269,108 +332,86 @@ sf::Color getTileColorForBodyType(phys::bodyType type, const sf::Color& defaultC
     }
 }
 
-void setupLevelAssets(const LevelData& data, sf::RenderWindow& window) {
-    bodies.clear();
-    tiles.clear();
-    activeMovingPlatforms.clear();
-    activeInteractibles.clear();
+// tiles got replaced wholesale. moving/falling/vanishing tiles change every tick and get their own batches, the rest
+// is baked and only rebaked when a change to one of its tiles comes through tileChanges
+void rebuildTileBatches() {
+    spriteManager.bindAnimations(tiles, bodies);
+    std::vector<std::size_t> dynamicTiles = levelRuntime.getMovingIndices();
+    const std::vector<std::size_t>& fallingOrVanishing = levelRuntime.getFallingOrVanishingIndices();
+    dynamicTiles.insert(dynamicTiles.end(), fallingOrVanishing.begin(), fallingOrVanishing.end());
+    // animated tiles swap texture rects, a static cell would be rebaked on every frame change
+    const std::vector<std::size_t>& animated = spriteManager.getAnimatedTiles();
+    dynamicTiles.insert(dynamicTiles.end(), animated.begin(), animated.end());
+    tileBatches.build(tiles, dynamicTiles);
+    tileChanges.reset(tiles.size());
+}
 
-    playerBody.setPosition(data.playerStartPosition);
+// pristine copy of what setupLevelAssets builds, taken right after it runs. respawning copies it back
+// instead of going through LevelManager, so no file io and no decode. tiles keep pointing at the textures in currentLevelData
+struct LevelSnapshot {
+    int levelNumber = 0; // LevelManager's number, 0 = nothing captured
+    std::vector<phys::PlatformBody> bodies;
+    std::vector<Tile> tiles;
+    std::vector<ActiveMovingPlatform> movingPlatforms;
+    std::map<unsigned int, ActiveInteractiblePlatform> interactibles;
+    LevelRuntime runtime;
+    phys::DynamicAABBTree tree{PLATFORM_TREE_FAT_MARGIN};
+};
+LevelSnapshot levelSnapshot;
+long long lastRespawnMicroseconds = -1; // last snapshot restore, -1 until the first one
+
+void resetPlayerToStart(const sf::Vector2f& startPosition) {
+    playerBody.setPosition(startPosition);
     playerBody.setVelocity({0.f, 0.f});
     playerBody.setOnGround(false);
-    playerBody.setGroundPlatform(nullptr);
-    playerBody.setLastPosition(data.playerStartPosition);
-
-    std::cout << "Level " << data.levelNumber << " - TexturesList contains keys: ";
-    for (const auto& [id, tex] : data.TexturesList) {
-        std::cout << id << " ";
-    }
-    std::cout << std::endl;
-
-
-    // Load custom background, if existing
-    std::cout << "CHECKING FOR LEVEL BACKGROUND: " << data.levelNumber << std::endl;
-    if (data.TexturesList.find(LEVEL_BG_ID) != data.TexturesList.end()){
-        // Level has custom background
-        std::cout << "FOUND LEVEL " << data.levelNumber << " BACKGROUND!" << std::endl;
-        if (LevelBackgrounds.find(data.levelNumber) == LevelBackgrounds.end()){
-            sf::Texture levelbg = data.TexturesList.find(LEVEL_BG_ID)->second;
-            LevelBackgrounds.emplace(data.levelNumber, std::move(levelbg));
-            std::cout << "LOADED LEVEL BACKGROUND: " << data.levelNumber << std::endl;
-        }
-    }
+    playerBody.setGroundPlatform(phys::BodyHandle{});
+    playerBody.setLastPosition(startPosition);
+}
 
-    bodies.reserve(data.platforms.size());
-    for (const auto& p_body_template : data.platforms) {
-        bodies.push_back(p_body_template);
-        phys::PlatformBody& new_body_ref = bodies.back();
-
-        if (new_body_ref.getType() == phys::bodyType::moving) {
-            bool foundDetail = false;
-            for(const auto& detail : data.movingPlatformDetails){
-                if(detail.id == new_body_ref.getID()){
-                    sf::Vector2f movementAnchor = detail.startPosition;
-                    float t0_offset = 0.f;
-                    if (detail.cycleDuration > 0.f && detail.cycleDuration / 2.0f > 1e-5f) {
-                        t0_offset = math::easing::sineEaseInOut(
-                            0.f, 0.f,
-                            static_cast<float>(detail.initialDirection) * detail.distance,
-                            detail.cycleDuration / 2.0f
-                        );
-                    }
-                    sf::Vector2f calculatedInitialPos = movementAnchor;
-                    if(detail.axis == 'x') calculatedInitialPos.x += t0_offset;
-                    else if(detail.axis == 'y') calculatedInitialPos.y += t0_offset;
+void captureLevelSnapshot() {
+    levelSnapshot.levelNumber = levelManager.getCurrentLevelNumber();
+    levelSnapshot.bodies = bodies;
+    levelSnapshot.tiles = tiles;
+    levelSnapshot.movingPlatforms = activeMovingPlatforms;
+    levelSnapshot.interactibles = activeInteractibles;
+    levelSnapshot.runtime = levelRuntime;
+    levelSnapshot.tree = platformTree;
+}
 
-                    if (std::abs(new_body_ref.getPosition().x - calculatedInitialPos.x) > 0.1f ||
-                        std::abs(new_body_ref.getPosition().y - calculatedInitialPos.y) > 0.1f) {
-                         new_body_ref.setPosition(calculatedInitialPos);
-                    }
+// false when there's no snapshot for the level LevelManager thinks is running, caller falls back to a normal respawn load
+bool restoreLevelSnapshot() {
+    if (levelSnapshot.levelNumber == 0 || levelSnapshot.levelNumber != levelManager.getCurrentLevelNumber()) return false;
+    const auto start = std::chrono::steady_clock::now();
+
+    // same sizes every time, so these copy into the storage that's already there
+    bodies = levelSnapshot.bodies;
+    tiles = levelSnapshot.tiles;
+    activeMovingPlatforms = levelSnapshot.movingPlatforms;
+    activeInteractibles = levelSnapshot.interactibles;
+    levelRuntime = levelSnapshot.runtime;
+    platformTree = levelSnapshot.tree;
+    collisionWorld.rebuild(bodies); // new epoch, handles and contact caches from the last attempt go stale
+    spriteManager.resetAnimations();
+    rebuildTileBatches();
+    restingFastTicks = 0;
+    fullSolveTicks = 0;
+
+    resetPlayerToStart(currentLevelData.playerStartPosition);
+    vanishingPlatformCycleTimer = sf::Time::Zero;
+    oddEvenVanishing = 1;
 
-                    activeMovingPlatforms.push_back({
-                        detail.id, movementAnchor, detail.axis, detail.distance,
-                        0.0f,
-                        detail.cycleDuration, detail.initialDirection,
-                        new_body_ref.getPosition()
-                    });
-                    foundDetail = true;
-                    break;
-                }
-            }
-            if(!foundDetail){
-                std::cerr << "Warning: Moving platform ID " << p_body_template.getID()
-                          << " (type 'moving' in JSON) missing movement details in LevelData. Will be static." << std::endl;
-            }
-        }
-        else if (new_body_ref.getType() == phys::bodyType::interactible) {
-            bool foundDetail = false;
-            for (const auto& detail : data.interactiblePlatformDetails) {
-                if (detail.id == new_body_ref.getID()) {
-                    activeInteractibles[detail.id] = {
-                        detail.id, detail.interactionType,
-                        levelManager.stringToBodyType(detail.targetBodyTypeStr),
-                        detail.targetTileColor, detail.hasTargetTileColor,
-                        detail.oneTime, detail.cooldown,
-                        false,
-                        0.f,
-                        detail.linkedID
-                    };
-                    foundDetail = true;
-                    break;
-                }
-            }
-            if (!foundDetail) {
-                std::cerr << "Warning: Interactible platform ID " << p_body_template.getID()
-                          << " (type 'interactible' in JSON) missing interaction details in LevelData. Will be static or unresponsive." << std::endl;
-            }
-        }
-    }
+    lastRespawnMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Respawned level " << levelSnapshot.levelNumber << " from snapshot in " << lastRespawnMicroseconds << " us" << std::endl;
+    return true;
+}
 
-tiles.reserve(bodies.size());
-for (const auto& body : bodies) {
+// tile for one body, textured out of currentLevelData (from the atlas page when its texture got packed) and cut to its
+// entry in dimensions (the level's, or the chunk's when streamed)
+// logLoad is for the level load only, streamed chunks and hot reloads make tiles mid-frame and stay quiet
+Tile makeTile(const phys::PlatformBody& body, const std::map<int, sf::IntRect>& dimensions, bool logLoad = false) {
     // get body texture first
     std::string bodyTexturePath = body.getTexturePath();
-    std::cout << bodyTexturePath << std::endl;
+    if (logLoad) std::cout << bodyTexturePath << std::endl;
     // find texture in loaded textures
 
 
@@ -384,17 +425,22 @@ for (const auto& body : bodies) {
     //find texture in loaded textures
     if (!bodyTexturePath.empty()){
         auto textureLiIt = currentLevelData.TexturesList.find(bodyTexturePath);
-        if (textureLiIt != currentLevelData.TexturesList.end()){
+        // streamed levels only load the start area up front, the rest is pinned by the streamer's resident chunks
+        const sf::Texture* texture = textureLiIt != currentLevelData.TexturesList.end() ? textureLiIt->second.get()
+                                                                                      : levelManager.getStreamer().findTexture(bodyTexturePath);
+        if (texture){
             // texture is loaded in list
-            newTile.setTexture(&(textureLiIt->second));
-            std::cout << "Loaded object of texture: " << textureLiIt->first << std::endl;
+            const TextureAtlas::Region* atlasRegion = currentLevelData.atlas ? currentLevelData.atlas->find(bodyTexturePath) : nullptr;
+            if (atlasRegion) newTile.setTexture(&currentLevelData.atlas->getPage(atlasRegion->page), atlasRegion->rect);
+            else newTile.setTexture(texture);
+            if (logLoad) std::cout << "Loaded object of texture: " << bodyTexturePath << std::endl;
 
             // adjust object dimensions
-            auto textureDiIt = currentLevelData.TexturesDimensions.find(body.getID());
-            if (textureDiIt != currentLevelData.TexturesDimensions.end()){
+            auto textureDiIt = dimensions.find(body.getID());
+            if (textureDiIt != dimensions.end()){
                 // object has custom dimensions
                 newTile.setTextureRect(textureDiIt->second);
-                std::cout << "Adjusted obj " << body.getID() << " dimensions to: ["
+                if (logLoad) std::cout << "Adjusted obj " << body.getID() << " dimensions to: ["
                 << textureDiIt->second.position.x << "," << textureDiIt->second.position.y << "] x ["
                 << (textureDiIt->second.size.x + textureDiIt->second.position.x) << ","
                 << (textureDiIt->second.size.y + textureDiIt->second.position.y) << "]" << std::endl;
@@ -402,20 +448,265 @@ for (const auto& body : bodies) {
         }
         else {
             // texture not found; load default texture instead
-            sf::Texture d(DEFAULT_TEXTURE_FILEPATH);
-            newTile.setTexture(&d);
-            std::cout << "Failed to load texture " << textureLiIt -> first << std::endl;
+            newTile.setTexture(&assets.texture(DEFAULT_TEXTURE_FILEPATH).get());
+            if (logLoad) std::cout << "Failed to load texture " << bodyTexturePath << std::endl;
         }
     }
 
     // Determine if tile is special block
     if (body.getType() == phys::bodyType::goal) newTile.setSpecialTile(Tile::SpecialTile::GOAL);
 
-    tiles.push_back(newTile);
+    return newTile;
 }
 
+// p_body_template written to bodies[bodyIndex], with its moving/interactible state out of data
+void addBody(const LevelData& data, const phys::PlatformBody& p_body_template, std::size_t bodyIndex) {
+    bodies[bodyIndex] = p_body_template;
+    phys::PlatformBody& new_body_ref = bodies[bodyIndex];
+
+    if (new_body_ref.getType() == phys::bodyType::moving) {
+        bool foundDetail = false;
+        for(const auto& detail : data.movingPlatformDetails){
+            if(detail.id == new_body_ref.getID()){
+                sf::Vector2f movementAnchor = detail.startPosition;
+                float t0_offset = 0.f;
+                if (detail.cycleDuration > 0.f && detail.cycleDuration / 2.0f > 1e-5f) {
+                    t0_offset = math::easing::sineEaseInOut(
+                        0.f, 0.f,
+                        static_cast<float>(detail.initialDirection) * detail.distance,
+                        detail.cycleDuration / 2.0f
+                    );
+                }
+                sf::Vector2f calculatedInitialPos = movementAnchor;
+                if(detail.axis == 'x') calculatedInitialPos.x += t0_offset;
+                else if(detail.axis == 'y') calculatedInitialPos.y += t0_offset;
+
+                if (std::abs(new_body_ref.getPosition().x - calculatedInitialPos.x) > 0.1f ||
+                    std::abs(new_body_ref.getPosition().y - calculatedInitialPos.y) > 0.1f) {
+                     new_body_ref.setPosition(calculatedInitialPos);
+                }
+
+                activeMovingPlatforms.push_back({
+                    detail.id, movementAnchor, detail.axis, detail.distance,
+                    0.0f,
+                    detail.cycleDuration, detail.initialDirection,
+                    new_body_ref.getPosition(),
+                    bodyIndex
+                });
+                foundDetail = true;
+                break;
+            }
+        }
+        if(!foundDetail){
+            std::cerr << "Warning: Moving platform ID " << p_body_template.getID()
+                      << " (type 'moving' in JSON) missing movement details in LevelData. Will be static." << std::endl;
+        }
+    }
+    else if (new_body_ref.getType() == phys::bodyType::interactible) {
+        bool foundDetail = false;
+        for (const auto& detail : data.interactiblePlatformDetails) {
+            if (detail.id == new_body_ref.getID()) {
+                activeInteractibles[detail.id] = {
+                    detail.id, detail.interactionType,
+                    levelManager.stringToBodyType(detail.targetBodyTypeStr),
+                    detail.targetTileColor, detail.hasTargetTileColor,
+                    detail.oneTime, detail.cooldown,
+                    false,
+                    0.f,
+                    detail.linkedID
+                };
+                foundDetail = true;
+                break;
+            }
+        }
+        if (!foundDetail) {
+            std::cerr << "Warning: Interactible platform ID " << p_body_template.getID()
+                      << " (type 'interactible' in JSON) missing interaction details in LevelData. Will be static or unresponsive." << std::endl;
+        }
+    }
+}
+
+// a streamed chunk became resident. its platforms get a run of body slots (one an evicted chunk gave back, or new ones
+// at the end) and only those bodies go into the runtime lists, the tree, the collision world and the tile batches
+void activateChunk(const LevelData& data, std::size_t chunk, bool logLoad = false) {
+    const LevelStreamer& streamer = levelManager.getStreamer();
+    const std::vector<phys::PlatformBody>& platforms = streamer.getChunkPlatforms(chunk);
+    const std::map<int, sf::IntRect>& dimensions = streamer.getChunkDimensions(chunk);
+    const std::size_t count = platforms.size();
+    const std::size_t first = levelRuntime.allocateBodies(count, bodies.size());
+    const std::size_t end = first + count;
+    if (end > bodies.size()) {
+        bodies.resize(end);
+        bodyChunks.resize(end, LevelRuntime::NoIndex);
+        tiles.resize(end);
+        collisionWorld.resize(end);
+    }
+
+    for (std::size_t i = first; i < end; ++i) {
+        addBody(data, platforms[i - first], i);
+        bodyChunks[i] = chunk;
+        tiles[i] = makeTile(bodies[i], dimensions, logLoad);
+    }
+    // per-type lists follow the level file, every body is still a plain copy of its template here
+    levelRuntime.addBodies(bodies, first, count);
+    for (std::size_t i = first; i < end; ++i) {
+        platformTree.insertBody(i, bodies[i].getAABB());
+        collisionWorld.sync(i);
+    }
+    spriteManager.bindAnimations(tiles, bodies, first, count);
+
+    // same split as rebuildTileBatches, for this chunk's slots only
+    std::vector<std::size_t> dynamicTiles;
+    auto addInRange = [&dynamicTiles, first, end](const std::vector<std::size_t>& indices) {
+        for (std::size_t index : indices) {
+            if (index >= first && index < end) dynamicTiles.push_back(index);
+        }
+    };
+    addInRange(levelRuntime.getMovingIndices());
+    addInRange(levelRuntime.getFallingOrVanishingIndices());
+    addInRange(spriteManager.getAnimatedTiles());
+    tileBatches.addTiles(first, count, dynamicTiles);
+    chunkBodies[chunk] = ChunkBodies{first, count};
+}
+
+// a streamed chunk got evicted. its bodies leave the same structures one by one, live state goes with them (it comes
+// back as the level file has it), and the slots are left inert for the next chunk that needs room
+void evictChunk(std::size_t chunk) {
+    const ChunkBodies range = chunkBodies[chunk];
+    if (range.count == 0) return;
+    const std::size_t first = range.first;
+    const std::size_t end = first + range.count;
+
+    const phys::BodyHandle ground = playerBody.getGroundPlatform();
+    if (collisionWorld.isValid(ground) && ground.index >= first && ground.index < end) {
+        playerBody.setOnGround(false);
+        playerBody.setGroundPlatform(phys::BodyHandle{});
+    }
+
+    tileBatches.removeTiles(first, range.count);
+    spriteManager.unbindAnimations(first, range.count);
+    levelRuntime.removeBodies(bodies, first, range.count);
+    activeMovingPlatforms.erase(std::remove_if(activeMovingPlatforms.begin(), activeMovingPlatforms.end(),
+                                               [first, end](const ActiveMovingPlatform& moving) { return moving.bodyIndex >= first && moving.bodyIndex < end; }),
+                                activeMovingPlatforms.end());
+    for (std::size_t i = first; i < end; ++i) {
+        if (templateOf(i).getType() == phys::bodyType::interactible) activeInteractibles.erase(templateOf(i).getID());
+        platformTree.removeBody(i);
+        collisionWorld.release(i);
+        // no texture pointer or goal flag left behind for whoever scans every tile
+        bodies[i] = phys::PlatformBody(0, {0.f, 0.f}, 0.f, 0.f, phys::bodyType::none);
+        bodyChunks[i] = LevelRuntime::NoIndex;
+        tiles[i] = Tile();
+    }
+    levelRuntime.releaseBodies(first, range.count);
+    chunkBodies[chunk] = ChunkBodies{};
+}
+
+void setupLevelAssets(const LevelData& data, sf::RenderWindow& window, const sf::Vector2f* streamCenter = nullptr) {
+    bodies.clear();
+    bodyChunks.clear();
+    tiles.clear();
+    activeMovingPlatforms.clear();
+    activeInteractibles.clear();
+
+    resetPlayerToStart(data.playerStartPosition);
+    spriteManager.loadAnimations(data);
+
+    std::cout << "Level " << data.levelNumber << " - TexturesList contains keys: ";
+    for (const auto& [id, tex] : data.TexturesList) {
+        std::cout << id << " ";
+    }
+    std::cout << std::endl;
+
+
+    // Load custom background, if existing
+    std::cout << "CHECKING FOR LEVEL BACKGROUND: " << data.levelNumber << std::endl;
+    levelBackground.reset();
+    if (data.TexturesList.find(LEVEL_BG_ID) != data.TexturesList.end()){
+        // Level has custom background
+        std::cout << "FOUND LEVEL " << data.levelNumber << " BACKGROUND!" << std::endl;
+        levelBackground = data.TexturesList.find(LEVEL_BG_ID)->second;
+    }
+
+    LevelStreamer& streamer = levelManager.getStreamer();
+    chunkBodies.clear();
+    if (!data.chunks.empty()) {
+        // only the chunks around the start (or wherever the player is on a reload) get bodies, the streamer adds the rest later
+        streamer.start(data, streamCenter ? *streamCenter : data.playerStartPosition);
+        chunkBodies.resize(data.chunks.size());
+    } else {
+        streamer.stop();
+        bodies.resize(data.platforms.size());
+        for (std::size_t i = 0; i < data.platforms.size(); ++i) addBody(data, data.platforms[i], i);
+    }
+
+    // indices line up with bodies, every body is still a plain copy of its template here
+    levelRuntime.build(bodies);
+    platformTree.build(bodies);
+    collisionWorld.rebuild(bodies);
+    restingFastTicks = 0;
+    fullSolveTicks = 0;
+
+tiles.reserve(bodies.size());
+for (const auto& body : bodies) {
+    tiles.push_back(makeTile(body, data.TexturesDimensions, true));
+}
+    rebuildTileBatches();
+    // a streamed level is still empty here, its starting chunks go in one at a time like any later chunk
+    for (std::size_t chunk : streamer.getActivated()) activateChunk(data, chunk, true);
+
     vanishingPlatformCycleTimer = sf::Time::Zero;
     oddEvenVanishing = 1;
+
+    if (streamer.isStreaming()) {
+        // which chunks are resident depends on where the player got to, respawns go through LevelManager instead
+        levelSnapshot.levelNumber = 0;
+        levelSnapshot.bodies.clear();
+        levelSnapshot.tiles.clear();
+    } else {
+        captureLevelSnapshot();
+    }
+}
+
+// currentLevelData was just replaced by an edited copy of the level file. only the platforms the edit touched are redone,
+// the rest of the level and the player carry on as they were
+void applyLevelReload(const LevelReload& reload, sf::RenderWindow& window) {
+    if (reload.structural) {
+        // ids or side tables moved around, indices don't line up anymore. rebuild, but put the player back where they were
+        const sf::Vector2f playerPosition = playerBody.getPosition();
+        const sf::Vector2f playerVelocity = playerBody.getVelocity();
+        setupLevelAssets(currentLevelData, window, &playerPosition);
+        playerBody.setPosition(playerPosition);
+        playerBody.setLastPosition(playerPosition);
+        playerBody.setVelocity(playerVelocity);
+        return;
+    }
+
+    // the snapshot holds the bodies as the old file had them, respawns should come back to the edited level too
+    const bool patchSnapshot = levelSnapshot.bodies.size() == bodies.size();
+    bool typeChanged = !patchSnapshot;
+    for (std::size_t index : reload.changedPlatforms) {
+        const phys::PlatformBody& edited = currentLevelData.platforms[index];
+
+        bodies[index] = edited;
+        platformTree.updateBody(index, edited.getAABB());
+        collisionWorld.sync(index);
+        tiles[index] = makeTile(edited, currentLevelData.TexturesDimensions);
+        tileChanges.mark(index, TileChangeList::All);
+
+        if (patchSnapshot) {
+            typeChanged = typeChanged || levelSnapshot.bodies[index].getType() != edited.getType();
+            levelSnapshot.bodies[index] = edited;
+            levelSnapshot.tree.updateBody(index, edited.getAABB());
+            levelSnapshot.tiles[index] = tiles[index];
+        }
+    }
+    if (typeChanged) {
+        // the per-type index lists follow what the level file says, not what the bodies turned into since
+        levelRuntime.build(currentLevelData.platforms);
+        levelSnapshot.runtime = levelRuntime;
+        rebuildTileBatches(); // a tile may have become (or stopped being) one that moves
+    }
 }
 
 void updateResolutionDisplayText() {
@@ -437,7 +728,13 @@ resolutionCurrentText.setOrigin({bounds.position.x + bounds.size.x / 2.f, bounds
 resolutionCurrentText.setPosition({LOGICAL_SIZE.x / 2.f, 320.f});
 }
 
-int main(void) {
+int main(int argc, char** argv) {
+    // --hot-reload: watch the level folder and reload the json while playing, for level editing. off by default
+    bool hotReload = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--hot-reload") hotReload = true;
+    }
+
     sf::RenderWindow window;
     sf::View uiView;
     sf::View mainView;
@@ -452,9 +749,12 @@ int main(void) {
     sf::Time currentJumpHoldDuration = sf::Time::Zero;
     int turboMultiplier = 1;
 
-sf::Font menuFont;
+    std::cout << "Swept AABB kernel: " << phys::CollisionSystem::sweepKernelName() << std::endl;
+
+FontHandle menuFontHandle = assets.font(FONT_PATH); // same font the resolution text was made with, loaded once
+sf::Font& menuFont = *menuFontHandle;
 sf::Text menuTitleText(menuFont), startButtonText(menuFont), settingsButtonText(menuFont), creditsButtonText(menuFont), exitButtonText(menuFont);
-sf::Texture menuBgTexture(IMG_MENU_BG); sf::Sprite menuBgSprite(menuBgTexture);
+TextureHandle menuBgTexture = assets.texture(IMG_MENU_BG); sf::Sprite menuBgSprite(*menuBgTexture);
 sf::Text settingsTitleText(menuFont), musicVolumeLabelText(menuFont), musicVolValText(menuFont), sfxVolumeLabelText(menuFont), sfxVolValText(menuFont), settingsBackText(menuFont);
 sf::Text musicVolDownText(menuFont), musicVolUpText(menuFont), sfxVolDownText(menuFont), sfxVolUpText(menuFont);
 sf::Text resolutionLabelText(menuFont), resolutionPrevText(menuFont), resolutionNextText(menuFont), fullscreenToggleText(menuFont);
@@ -469,19 +769,8 @@ bool menuBgSpriteLoaded = false;
 
 bool goalReached = false;
 bool doorAnimationOngoing = false;
-std::vector<sf::Vector2f>doorAnimFramesTopLeft;
-    doorAnimFramesTopLeft.push_back(sf::Vector2f(1275, 255));
-    doorAnimFramesTopLeft.push_back(sf::Vector2f(250, 1275));
-    doorAnimFramesTopLeft.push_back(sf::Vector2f(1275, 1275));
-    doorAnimFramesTopLeft.push_back(sf::Vector2f(250, 2305));
-    doorAnimFramesTopLeft.push_back(sf::Vector2f(1275,255));
-int doorWidth = 455;
-int doorHeight = 610;
-int doorCurrentFrame = 0;
-sf::Clock animClock;
-float secondsPerFrame_door = 0.20f;
-Tile* animatedDoorTile = nullptr;
-sf::Time frameTime_door = sf::seconds(secondsPerFrame_door);
+// the goal door's clip comes from the level json, a goal without one finishes the level right away
+std::size_t doorAnimation = sprites::SpriteManager::NoAnimation;
 
     // --- Game Constants ---
     const float PLAYER_MOVE_SPEED = 200.f;
@@ -501,6 +790,7 @@ sf::Time frameTime_door = sf::seconds(secondsPerFrame_door);
     GameState currentState = GameState::MENU;
     levelManager.setMaxLevels(5);
     levelManager.setLevelBasePath("../assets/levels/");
+    levelManager.setHotReloadEnabled(hotReload); // one non-blocking read a frame, edits to the level json show up while playing
     levelManager.setTransitionProperties(0.75f);
     levelManager.setGeneralLoadingScreenImage(IMG_LOAD_GENERAL);
     levelManager.setNextLevelLoadingScreenImage(IMG_LOAD_NEXT);
@@ -510,7 +800,7 @@ sf::Time frameTime_door = sf::seconds(secondsPerFrame_door);
 
     playerBody = phys::DynamicBody({0,0}, tileSize.x+16, tileSize.y*2);
 
-if (!menuFont.openFromFile(FONT_PATH)) {
+if (menuFontHandle.isFallback()) {
     std::cerr << "FATAL: Failed to load font: " << FONT_PATH << ". Trying fallback." << std::endl;
     #if defined(_WIN32)
     if (!menuFont.openFromFile("C:/Windows/Fonts/arialbd.ttf")) { std::cerr << "Windows fallback font failed.\n"; return -1; }
@@ -535,12 +825,12 @@ auto setupTextUI = [&](sf::Text& text, const sf::String& str, float yPos, unsign
     text.setPosition({LOGICAL_SIZE.x / 2.f + xOffset, yPos});
 };
 
-if (menuBgTexture.loadFromFile(IMG_MENU_BG)) {
-    menuBgSprite.setTexture(menuBgTexture);
+if (!menuBgTexture.isFallback()) {
+    menuBgSprite.setTexture(*menuBgTexture);
     menuBgSpriteLoaded = true;
-    if (menuBgTexture.getSize().x > 0 && menuBgTexture.getSize().y > 0) {
-        menuBgSprite.setScale({LOGICAL_SIZE.x / (menuBgTexture.getSize().x),
-                              LOGICAL_SIZE.y / (menuBgTexture.getSize().y)});
+    if (menuBgTexture->getSize().x > 0 && menuBgTexture->getSize().y > 0) {
+        menuBgSprite.setScale({LOGICAL_SIZE.x / (menuBgTexture->getSize().x),
+                              LOGICAL_SIZE.y / (menuBgTexture->getSize().y)});
     }
     menuBgSprite.setPosition({0.f,0.f});
     std::cout << "Loaded " << IMG_MENU_BG << std::endl;
@@ -630,7 +920,7 @@ else {
         std::cerr << "Cannot load player texture." << std::endl;
         playerTexture.loadFromFile(DEFAULT_TEXTURE_FILEPATH);
     }*/
-    playerShape.setTexture(&playerTexture);
+    playerShape.setTexture(&playerTexture.get());
     sf::IntRect playerDimensions = sprites::SpriteManager::GetPlayerTextureUponMovement(sprites::SpriteManager::NONE);
     playerShape.setTextureRect(playerDimensions);
 
@@ -651,6 +941,7 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
     while (running) {
         interactKeyPressedThisFrame = false;
         sf::Time frameDeltaTime = gameClock.restart();
+        assets.beginFrame();
 
     //sf::Event event;
     while (const std::optional event = window.pollEvent()) {
@@ -758,7 +1049,10 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                         if(menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFile(AUDIO_MUSIC_MENU)) menuMusic.play();
                     } else if (keyPressed->scancode== sf::Keyboard::Scancode::R) {
                         playSfx("click");
-                        if (levelManager.requestRespawnCurrentLevel(currentLevelData)) {
+                        if (restoreLevelSnapshot()) {
+                            goalReached = false;
+                            doorAnimationOngoing = false;
+                        } else if (levelManager.requestRespawnCurrentLevel(currentLevelData)) {
                             currentState = GameState::TRANSITIONING;
                         } else {std::cerr << "PLAYING: Failed respawn request.\n";}
                     } else if (keyPressed->scancode == sf::Keyboard::Scancode::E) {
@@ -774,7 +1068,11 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                         playSfx("click");
                         if (gameOverOption1Text.getGlobalBounds().contains(worldPosUi)) {
                             if (currentState == GameState::GAME_OVER_LOSE_FALL || currentState == GameState::GAME_OVER_LOSE_DEATH) { // Retry
-                                if (levelManager.requestRespawnCurrentLevel(currentLevelData)) {
+                                if (restoreLevelSnapshot()) {
+                                    currentState = GameState::PLAYING;
+                                    if(menuMusic.getStatus() == sf::Music::Status::Playing) menuMusic.stop();
+                                    if(gameMusic.getStatus() != sf::Music::Status::Playing && gameMusic.openFromFile(AUDIO_MUSIC_GAME)) gameMusic.play();
+                                } else if (levelManager.requestRespawnCurrentLevel(currentLevelData)) {
                                     currentState = GameState::TRANSITIONING;
                                     if(menuMusic.getStatus() == sf::Music::Status::Playing) menuMusic.stop();
                                     if(gameMusic.getStatus() != sf::Music::Status::Playing && gameMusic.openFromFile(AUDIO_MUSIC_GAME)) gameMusic.play();
@@ -819,10 +1117,23 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
         // --- Game Logic Update ---
         if (currentState == GameState::PLAYING && !goalReached) {
+            LevelReload levelReload;
+            if (levelManager.pollHotReload(currentLevelData, levelReload)) {
+                applyLevelReload(levelReload, window);
+            }
+            // big levels: chunks around the camera come in, far ones go
+            LevelStreamer& streamer = levelManager.getStreamer();
+            if (streamer.isStreaming() && streamer.update(mainView.getCenter())) {
+                // evicted first, their slots are what the new ones move into
+                for (std::size_t chunk : streamer.getEvicted()) evictChunk(chunk);
+                for (std::size_t chunk : streamer.getActivated()) activateChunk(currentLevelData, chunk);
+            }
+
             playerShape.setSize(sf::Vector2f(playerBody.getWidth(), playerBody.getHeight()));
 
             while (timeSinceLastFixedUpdate >= TIME_PER_FIXED_UPDATE) {
                 timeSinceLastFixedUpdate -= TIME_PER_FIXED_UPDATE;
+                tileChanges.endTick(); // the tick before this one is done, its change count goes to the hud
                 const float fixed_dt_seconds = TIME_PER_FIXED_UPDATE.asSeconds();
 
                 playerBody.setLastPosition(playerBody.getPosition());
@@ -847,12 +1158,8 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
             bool newJumpPressThisFrame = (jumpIntentThisFrame && playerBody.isOnGround() && currentJumpHoldDuration == sf::Time::Zero);
 
                 if (newJumpPressThisFrame && !playerBody.getGroundPlatformTemporarilyIgnored()) {
-                    const phys::PlatformBody* groundPlat = playerBody.getGroundPlatform();
-                    bool safeToAccessGroundPlat = false;
-                    if (groundPlat) {
-                        for (const auto& body_ref : bodies) { if (&body_ref == groundPlat) { safeToAccessGroundPlat = true; break; } }
-                    }
-                    if (!safeToAccessGroundPlat || groundPlat->getType() != phys::bodyType::spring) {
+                    const phys::PlatformBody* groundPlat = collisionWorld.get(playerBody.getGroundPlatform()); // nullptr if stale
+                    if (!groundPlat || groundPlat->getType() != phys::bodyType::spring) {
                          playSfx("jump");
                     }
                 }
@@ -860,13 +1167,10 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
                 // --- Update Moving Platforms ---
                 for(auto& activePlat : activeMovingPlatforms) {
-                    phys::PlatformBody* movingBodyPtr = nullptr; size_t tileIdx = (size_t)-1;
-                    for(size_t i_plat=0; i_plat < bodies.size(); ++i_plat) {
-                        if(bodies[i_plat].getID() == activePlat.id && bodies[i_plat].getType() == phys::bodyType::moving) {
-                            movingBodyPtr = &bodies[i_plat];
-                            tileIdx = i_plat;
-                            break;
-                        }
+                    const size_t tileIdx = activePlat.bodyIndex;
+                    phys::PlatformBody* movingBodyPtr = nullptr;
+                    if (tileIdx < bodies.size() && bodies[tileIdx].getType() == phys::bodyType::moving) {
+                        movingBodyPtr = &bodies[tileIdx];
                     }
 
                     if (movingBodyPtr) {
@@ -890,9 +1194,9 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                         if(activePlat.axis == 'x') newPos.x += offset;
                         else if(activePlat.axis == 'y') newPos.y += offset;
 
-                        movingBodyPtr->setPosition(newPos);
+                        moveBody(tileIdx, newPos);
                         if (tileIdx < tiles.size()) {
-                            tiles[tileIdx].setPosition(newPos);
+                            setTilePosition(tileIdx, newPos);
                         }
                     }
                 }
@@ -907,52 +1211,45 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                 }
 
                 // --- Update Platform States (Falling, Vanishing) ---
-                for (size_t i_body = 0; i_body < bodies.size(); ++i_body) {
-                    if (tiles.size() <= i_body) continue;
+                for (size_t i_body : levelRuntime.getFallingOrVanishingIndices()) {
+                    if (tiles.size() <= i_body || bodies.size() <= i_body) continue;
 
                     phys::PlatformBody& current_body = bodies[i_body];
                     Tile& current_tile = tiles[i_body];
 
-                    const phys::PlatformBody* template_body_ptr = nullptr;
-                    sf::Vector2f originalPos = {-9999.f, -9999.f};
-
-                    for(const auto& templ : currentLevelData.platforms) {
-                        if(templ.getID() == current_body.getID()){
-                            template_body_ptr = &templ;
-                            originalPos = templ.getPosition();
-                            break;
-                        }
-                    }
-
-                    if (!template_body_ptr) {
-                        continue;
-                    }
+                    const phys::PlatformBody* template_body_ptr = &templateOf(i_body);
+                    sf::Vector2f originalPos = template_body_ptr->getPosition();
 
                     if (template_body_ptr->getType() == phys::bodyType::falling) {
                         if (!current_body.isFalling()) {
-                              bool playerOnThis = playerBody.isOnGround() && playerBody.getGroundPlatform() == &current_body;
+                              bool playerOnThis = playerBody.isOnGround() && playerBody.getGroundPlatform() == collisionWorld.handleOf(i_body);
                               if (playerOnThis && !current_tile.isFalling() && !current_tile.hasFallen()) {
                                   current_tile.startFalling(sf::seconds(0.5f));
                               }
                         }
 
+                        const sf::Vector2f tilePositionBefore = current_tile.getPosition();
+                        const bool fallenBefore = current_tile.hasFallen();
                         current_tile.update(TIME_PER_FIXED_UPDATE);
+                        if (current_tile.getPosition() != tilePositionBefore || current_tile.hasFallen() != fallenBefore) {
+                            tileChanges.mark(i_body, TileChangeList::Position);
+                        }
 
                         if (current_tile.isFalling() && !current_body.isFalling()) {
                             current_body.setFalling(true);
                         }
                         if (current_tile.isFalling() && current_body.isFalling()) {
-                            current_body.setPosition(current_tile.getPosition());
+                            moveBody(i_body, current_tile.getPosition());
                         }
 
                         if (current_tile.hasFallen() && current_body.getType() != phys::bodyType::none) {
-                            if (playerBody.getGroundPlatform() == &current_body) {
+                            if (playerBody.getGroundPlatform() == collisionWorld.handleOf(i_body)) {
                                 playerBody.setOnGround(false);
-                                playerBody.setGroundPlatform(nullptr);
+                                playerBody.setGroundPlatform(phys::BodyHandle{});
                             }
-                            current_body.setPosition({-9999.f, -9999.f});
-                            current_body.setType(phys::bodyType::none);
-                            current_tile.setFillColor(sf::Color::Transparent);
+                            moveBody(i_body, {-9999.f, -9999.f});
+                            setBodyType(i_body, phys::bodyType::none);
+                            setTileColor(i_body, sf::Color::Transparent);
                         }
                     }
                     else if (template_body_ptr->getType() == phys::bodyType::vanishing) {
@@ -971,33 +1268,27 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                     alpha_val = std::max(0.f, std::min(255.f, alpha_val)); // Clamp alpha
                     uint8_t finalAlphaByte = static_cast<uint8_t>(alpha_val);
 
-                        if (alpha_val <= 10.f) {
-                            if (current_body.getType() != phys::bodyType::none) {
-                                if (playerBody.getGroundPlatform() == &current_body) {
+                        // the body's type says which side of the fade it's on, so the body and tile only move when that flips
+                        const bool shown = alpha_val > 10.f && originalPos.x > -9998.f;
+                        const bool wasShown = current_body.getType() != phys::bodyType::none;
+                        if (shown != wasShown) {
+                            if (!shown) {
+                                if (playerBody.getGroundPlatform() == collisionWorld.handleOf(i_body)) {
                                     playerBody.setOnGround(false);
-                                    playerBody.setGroundPlatform(nullptr);
+                                    playerBody.setGroundPlatform(phys::BodyHandle{});
                                 }
-                                current_body.setType(phys::bodyType::none);
-                            }
-                            if (current_body.getPosition() != sf::Vector2f(-9999.f, -9999.f)) current_body.setPosition({-9999.f, -9999.f});
-                            if (current_tile.getPosition() != sf::Vector2f(-9999.f, -9999.f)) current_tile.setPosition({-9999.f, -9999.f});
-                            finalAlphaByte = 0;
-                        } else {
-                            if (current_body.getType() == phys::bodyType::none) {
-                                current_body.setType(phys::bodyType::vanishing);
-                            }
-                            if (originalPos.x > -9998.f) {
-                                if (current_body.getPosition() != originalPos) current_body.setPosition(originalPos);
-                                if (current_tile.getPosition() != originalPos) current_tile.setPosition(originalPos);
+                                setBodyType(i_body, phys::bodyType::none);
+                                moveBody(i_body, {-9999.f, -9999.f});
+                                setTilePosition(i_body, {-9999.f, -9999.f});
                             } else {
-                                if (current_body.getType() != phys::bodyType::none) current_body.setType(phys::bodyType::none);
-                                if(current_body.getPosition() != sf::Vector2f(-9999.f, -9999.f)) current_body.setPosition({-9999.f, -9999.f});
-                                if(current_tile.getPosition() != sf::Vector2f(-9999.f, -9999.f)) current_tile.setPosition({-9999.f, -9999.f});
-                                finalAlphaByte = 0;
+                                setBodyType(i_body, phys::bodyType::vanishing);
+                                moveBody(i_body, originalPos);
+                                setTilePosition(i_body, originalPos);
                             }
                         }
+                        if (!shown) finalAlphaByte = 0;
                         // REMOVED DEPENDENCE ON BLOCK TYPE COLOR - WILL NOW RENDER AS SPRITE
-                        current_tile.setFillColor(sf::Color(255, 255, 255, finalAlphaByte));
+                        setTileColor(i_body, sf::Color(255, 255, 255, finalAlphaByte));
                     }
                 }
 
@@ -1020,12 +1311,8 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                     pVel.y = JUMP_INITIAL_VELOCITY;
                     currentJumpHoldDuration = sf::microseconds(1);
                 } else if (jumpIntentThisFrame && currentJumpHoldDuration > sf::Time::Zero && currentJumpHoldDuration < MAX_JUMP_HOLD_TIME) {
-                    const phys::PlatformBody* groundPlatForJumpExtend = playerBody.getGroundPlatform();
-                    bool safeToAccessGroundPlatForJumpExtend = false;
-                    if(groundPlatForJumpExtend){
-                        for(const auto& body_ref : bodies){ if(&body_ref == groundPlatForJumpExtend){ safeToAccessGroundPlatForJumpExtend = true; break; } }
-                    }
-                    if (playerBody.getVelocity().y < 0.f && (!safeToAccessGroundPlatForJumpExtend || groundPlatForJumpExtend->getType() != phys::bodyType::spring) ) {
+                    const phys::PlatformBody* groundPlatForJumpExtend = collisionWorld.get(playerBody.getGroundPlatform());
+                    if (playerBody.getVelocity().y < 0.f && (!groundPlatForJumpExtend || groundPlatForJumpExtend->getType() != phys::bodyType::spring) ) {
                          pVel.y = JUMP_INITIAL_VELOCITY;
                     }
                     currentJumpHoldDuration += TIME_PER_FIXED_UPDATE;
@@ -1035,27 +1322,26 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                 playerBody.setVelocity(pVel);
 
                 // --- Collision Resolution ---
-                phys::CollisionResolutionInfo resolutionResult = phys::CollisionSystem::resolveCollisions(playerBody, bodies, fixed_dt_seconds);
+                phys::CollisionResolutionInfo resolutionResult = phys::CollisionSystem::resolveCollisions(playerBody, collisionWorld, platformTree, fixed_dt_seconds);
+                lastNarrowphaseTests = resolutionResult.narrowphaseTests;
+                if (resolutionResult.fromContactCache) ++restingFastTicks; else ++fullSolveTicks;
                 pVel = playerBody.getVelocity();
 
                 // --- Post-Collision Player Logic ---
                 if (playerBody.isOnGround()) {
                     currentJumpHoldDuration = sf::Time::Zero;
-                    const phys::PlatformBody* currentGroundPlatform = playerBody.getGroundPlatform();
+                    const phys::BodyHandle currentGroundPlatform = playerBody.getGroundPlatform();
 
                     if (currentGroundPlatform) {
-                        bool safeToAccessCurrentGroundPlatform = false;
-                        for (const auto& body_ref : bodies) { if (&body_ref == currentGroundPlatform) { safeToAccessCurrentGroundPlatform = true; break; } }
-
-                        if (safeToAccessCurrentGroundPlatform) {
-                            const phys::PlatformBody& pf = *currentGroundPlatform;
+                        if (collisionWorld.isValid(currentGroundPlatform)) {
+                            const phys::PlatformBody& pf = *collisionWorld.get(currentGroundPlatform);
                             if (pf.getType() == phys::bodyType::conveyorBelt) {
                                 playerBody.setPosition(playerBody.getPosition() + pf.getSurfaceVelocity() * fixed_dt_seconds);
                             } else if (pf.getType() == phys::bodyType::moving) {
                                  for(const auto& activePlat : activeMovingPlatforms) {
                                     if (activePlat.id == pf.getID()) {
                                         phys::PlatformBody* movingPhysBody = nullptr;
-                                        for(auto& b_ref : bodies) if(b_ref.getID() == activePlat.id && b_ref.getType() == phys::bodyType::moving) {movingPhysBody = &b_ref; break;}
+                                        if (activePlat.bodyIndex < bodies.size() && bodies[activePlat.bodyIndex].getType() == phys::bodyType::moving) movingPhysBody = &bodies[activePlat.bodyIndex];
 
                                         if(movingPhysBody){
                                             sf::Vector2f platformFrameDisplacement = movingPhysBody->getPosition() - activePlat.lastFrameActualPosition;
@@ -1067,12 +1353,12 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                             } else if (pf.getType() == phys::bodyType::spring) {
                                 pVel.y = SPRING_BOUNCE_VELOCITY;
                                 playerBody.setOnGround(false);
-                                playerBody.setGroundPlatform(nullptr);
+                                playerBody.setGroundPlatform(phys::BodyHandle{});
                                 playSfx("spring");
                             }
                         } else {
                              playerBody.setOnGround(false);
-                             playerBody.setGroundPlatform(nullptr);
+                             playerBody.setGroundPlatform(phys::BodyHandle{});
                         }
                     }
                 }
@@ -1084,9 +1370,12 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                 playerBody.setVelocity(pVel);
 
             // --- Trap Check ---
+            // one broadphase pass for traps, portals, goals and interactibles, the checks below only walk this list
+            phys::CollisionSystem::queryTriggers(playerBody.getAABB(), collisionWorld, platformTree, triggerHits);
+
             bool trapHit = false;
-            for (const auto& body_check_trap : bodies) {
-                if (body_check_trap.getType() == phys::bodyType::trap && body_check_trap.getAABB().findIntersection(playerBody.getAABB())) {
+            for (const phys::TriggerHit& hit : triggerHits) {
+                if (hit.type == phys::bodyType::trap) {
                     trapHit = true;
                     break;
                 }
@@ -1104,9 +1393,9 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                 bool interaction_occurred_this_frame = false; 
 
                 // --- Portal Interaction ---
-                for (const auto& entered_portal_body : bodies) {
-                    if (entered_portal_body.getType() == phys::bodyType::portal &&
-                        playerBody.getAABB().findIntersection(entered_portal_body.getAABB())) {
+                for (const phys::TriggerHit& hit : triggerHits) {
+                    const phys::PlatformBody& entered_portal_body = bodies[hit.bodyIndex];
+                    if (hit.type == phys::bodyType::portal) {
                         
                         playSfx("portal"); 
                         
@@ -1121,17 +1410,16 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                         }
 
                         phys::PlatformBody* destination_portal_ptr = nullptr;
-                        for (auto& potential_target_body : bodies) {
-                            if (potential_target_body.getID() == targetPortalPlatformID) {
-                                if (potential_target_body.getType() == phys::bodyType::portal) {
-                                    destination_portal_ptr = &potential_target_body;
-                                } else {
-                                    std::cerr << "Error: Portal ID " << entered_portal_body.getID()
-                                              << " links to ID " << targetPortalPlatformID
-                                              << ", but the target entity is not a portal (actual type: "
-                                              << static_cast<int>(potential_target_body.getType()) << ").\n";
-                                }
-                                break; 
+                        const std::size_t targetPortalIdx = levelRuntime.indexOf(targetPortalPlatformID);
+                        if (targetPortalIdx != LevelRuntime::NoIndex) {
+                            phys::PlatformBody& potential_target_body = bodies[targetPortalIdx];
+                            if (potential_target_body.getType() == phys::bodyType::portal) {
+                                destination_portal_ptr = &potential_target_body;
+                            } else {
+                                std::cerr << "Error: Portal ID " << entered_portal_body.getID()
+                                          << " links to ID " << targetPortalPlatformID
+                                          << ", but the target entity is not a portal (actual type: "
+                                          << static_cast<int>(potential_target_body.getType()) << ").\n";
                             }
                         }
 
@@ -1161,24 +1449,15 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
 
                 // --- Goal Interaction ---
- for (const auto& platform_body_check_goal : bodies) {
-                    if (platform_body_check_goal.getType() == phys::bodyType::goal && playerBody.getAABB().findIntersection(platform_body_check_goal.getAABB())) {
-                        for (auto tile : tiles){
-                            if (tile.getSpecialTile() == Tile::SpecialTile::GOAL){
+                for (const phys::TriggerHit& hit : triggerHits) {
+                    if (hit.type == phys::bodyType::goal) {
+                        for (std::size_t t = 0; t < tiles.size(); ++t){
+                            if (tiles[t].getSpecialTile() == Tile::SpecialTile::GOAL){
                                 // run door animation
-                                std::cout<<"DOOR ANIMATION!"<<std::endl;
-                                animatedDoorTile = &tile;
+                                doorAnimation = spriteManager.animationOfTile(t);
+                                spriteManager.playAnimation(doorAnimation);
                                 doorAnimationOngoing = true;
                                 goalReached = true;
-
-                                for (Tile& t : tiles){
-                                    if (t.getSpecialTile() == Tile::SpecialTile::GOAL){
-                                        animatedDoorTile = &t;
-                                        break;
-                                    }
-                                }
-
-                                animClock.restart();
                                 break;
                             }
                         }
@@ -1193,9 +1472,10 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
 
                 // --- Interactible Platform Interaction ---
-                for (size_t k = 0; k < bodies.size(); ++k) {
+                for (const phys::TriggerHit& hit : triggerHits) {
+                    const std::size_t k = hit.bodyIndex;
                     phys::PlatformBody& interact_body_ref = bodies[k];
-                    if (interact_body_ref.getType() == phys::bodyType::interactible && playerBody.getAABB().findIntersection(interact_body_ref.getAABB())) {
+                    if (hit.type == phys::bodyType::interactible) {
                         auto it = activeInteractibles.find(interact_body_ref.getID());
                         if (it != activeInteractibles.end()) {
                             ActiveInteractiblePlatform& interactState = it->second;
@@ -1205,70 +1485,64 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
                                 if (interactState.interactionType == "changeSelf") {
                                     playSfx("click");
-                                    interact_body_ref.setType(interactState.targetBodyTypeEnum);
+                                    setBodyType(k, interactState.targetBodyTypeEnum);
 
                                     if (tiles.size() > k) {
                                         if (interactState.hasTargetTileColor) {
-                                            tiles[k].setFillColor(interactState.targetTileColor);
+                                            setTileColor(k, interactState.targetTileColor);
                                         } else {
-                                            tiles[k].setFillColor(getTileColorForBodyType(interactState.targetBodyTypeEnum));
+                                            setTileColor(k, getTileColorForBodyType(interactState.targetBodyTypeEnum));
                                         }
                                     }
 
                                     if (interactState.targetBodyTypeEnum == phys::bodyType::none) {
-                                        if (playerBody.getGroundPlatform() == &interact_body_ref) {
+                                        if (playerBody.getGroundPlatform() == collisionWorld.handleOf(k)) {
                                             playerBody.setOnGround(false);
-                                            playerBody.setGroundPlatform(nullptr);
+                                            playerBody.setGroundPlatform(phys::BodyHandle{});
                                         }
-                                        interact_body_ref.setPosition({-10000.f, -10000.f}); 
-                                        if (tiles.size() > k) tiles[k].setFillColor(sf::Color::Transparent);
+                                        moveBody(k, {-10000.f, -10000.f});
+                                        if (tiles.size() > k) setTileColor(k, sf::Color::Transparent);
                                     }
 
                                     if (interactState.linkedID != 0) {
-                                        for (size_t linked_idx = 0; linked_idx < bodies.size(); ++linked_idx) {
-                                            if (bodies[linked_idx].getID() == interactState.linkedID) {
+                                        {
+                                            const size_t linked_idx = levelRuntime.indexOf(interactState.linkedID);
+                                            if (linked_idx != LevelRuntime::NoIndex && linked_idx < bodies.size()) {
                                                 phys::PlatformBody& linked_body_ref = bodies[linked_idx];
                                                 
-                                                Tile* linked_tile_ref_ptr = nullptr;
-                                                if (linked_idx < tiles.size()) {
-                                                    linked_tile_ref_ptr = &tiles[linked_idx];
-                                                }
-
+                                                const bool hasLinkedTile = linked_idx < tiles.size();
 
                                                 if (linked_body_ref.getType() == phys::bodyType::solid || linked_body_ref.getType() == phys::bodyType::platform ) {
-                                                    if (playerBody.getGroundPlatform() == &linked_body_ref) {
+                                                    if (playerBody.getGroundPlatform() == collisionWorld.handleOf(linked_idx)) {
                                                         playerBody.setOnGround(false);
-                                                        playerBody.setGroundPlatform(nullptr);
+                                                        playerBody.setGroundPlatform(phys::BodyHandle{});
                                                     }
-                                                    linked_body_ref.setType(phys::bodyType::none); 
-                                                    linked_body_ref.setPosition({-10000.f, -10000.f});
-                                                    if(linked_tile_ref_ptr) {
-                                                        linked_tile_ref_ptr->setFillColor(sf::Color::Transparent);
-                                                        linked_tile_ref_ptr->setPosition({-10000.f, -10000.f});
+                                                    setBodyType(linked_idx, phys::bodyType::none);
+                                                    moveBody(linked_idx, {-10000.f, -10000.f});
+                                                    if (hasLinkedTile) {
+                                                        setTileColor(linked_idx, sf::Color::Transparent);
+                                                        setTilePosition(linked_idx, {-10000.f, -10000.f});
                                                     }
 
                                                 } else if (linked_body_ref.getType() == phys::bodyType::none) {
                                                     sf::Vector2f originalLinkedPos = {-9999.f, -9999.f};
                                                     phys::bodyType originalLinkedType = phys::bodyType::solid; 
                                                     
-                                                    for(const auto& templ : currentLevelData.platforms){
-                                                        if(templ.getID() == linked_body_ref.getID()){
-                                                            originalLinkedPos = templ.getPosition();
-                                                            originalLinkedType = templ.getType(); 
-                                                            break;
-                                                        }
+                                                    if (linked_idx < bodies.size()) {
+                                                        const phys::PlatformBody& templ = templateOf(linked_idx);
+                                                        originalLinkedPos = templ.getPosition();
+                                                        originalLinkedType = templ.getType(); 
                                                     }
 
                                                     if(originalLinkedPos.x > -9998.f){ 
-                                                       linked_body_ref.setPosition(originalLinkedPos);
-                                                       linked_body_ref.setType(originalLinkedType);
-                                                       if(linked_tile_ref_ptr){
-                                                           linked_tile_ref_ptr->setPosition(originalLinkedPos);
-                                                           linked_tile_ref_ptr->setFillColor(getTileColorForBodyType(originalLinkedType));
+                                                       moveBody(linked_idx, originalLinkedPos);
+                                                       setBodyType(linked_idx, originalLinkedType);
+                                                       if (hasLinkedTile) {
+                                                           setTilePosition(linked_idx, originalLinkedPos);
+                                                           setTileColor(linked_idx, getTileColorForBodyType(originalLinkedType));
                                                        }
                                                     }
                                                 } 
-                                                break; // Found and processed linked body
                                             }
                                         }
                                     }
@@ -1312,9 +1586,9 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
             setupLevelAssets(currentLevelData, window);
 
             // Check for custom background
-            if (LevelBackgrounds.find(currentLevelData.levelNumber) != LevelBackgrounds.end()){
+            if (levelBackground){
                 // Has custom background
-                sf::Texture& levelBgTexture = LevelBackgrounds.find(currentLevelData.levelNumber)->second;
+                sf::Texture& levelBgTexture = *levelBackground;
                 // Resizing background to fit screen
                 float scaleX = 1.0f;
                 float scaleY = 1.0f;
@@ -1341,6 +1615,9 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
         }
     }
 
+        // every animated tile in one pass, also while the door opens (the logic above is paused once the goal is reached)
+        if (currentState == GameState::PLAYING) spriteManager.updateAnimations(frameDeltaTime, tiles, tileChanges);
+
         // --- Drawing ---
         window.setTitle("Celestial Speedrun");
         window.clear( (currentState == GameState::PLAYING ||
@@ -1348,7 +1625,7 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                         currentState == GameState::GAME_OVER_LOSE_DEATH ||
                         currentState == GameState::GAME_OVER_LOSE_FALL ||
                         currentState == GameState::GAME_OVER_WIN)
-                       && currentLevelData.platforms.size() > 0
+                       && (!currentLevelData.platforms.empty() || !currentLevelData.chunks.empty())
                        ? currentLevelData.backgroundColor
                        : sf::Color::Black);
 
@@ -1396,7 +1673,7 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
             break;
         case GameState::CREDITS:
             window.setView(uiView);
-              { sf::RectangleShape bg(LOGICAL_SIZE); sf::Texture bgTxtr(IMG_MENU_BG); bg.setTexture(&bgTxtr); 
+              { sf::RectangleShape bg(LOGICAL_SIZE); bg.setTexture(&menuBgTexture.get()); 
                 /*bg.setFillColor(sf::Color(20,60,20));*/ window.draw(bg); }
             creditsBackText.setFillColor(creditsBackText.getGlobalBounds().contains(currentMouseWorldUiPos) ? hoverBtnColor : defaultBtnColor);
             window.draw(creditsTitleText); window.draw(creditsNamesText); window.draw(creditsBackText);
@@ -1408,16 +1685,19 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
 
 
                 playerShape.setPosition(playerBody.getPosition());
-                for (Tile& t : tiles) {
-                    if (t.getFillColor().a > 0 && !t.hasFallen()) {
-                        if (doorAnimationOngoing){
-                            if (animatedDoorTile != &t){
-                                continue;
-                            }
-                        }
-                        window.draw(t);
-                        
-                    }
+                if (doorAnimationOngoing) {
+                    // only the door is left on screen while it opens
+                    const std::size_t doorTile = spriteManager.tileOfAnimation(doorAnimation);
+                    if (doorTile < tiles.size() && tiles[doorTile].getFillColor().a > 0 && !tiles[doorTile].hasFallen()) window.draw(tiles[doorTile]);
+                } else {
+                    const sf::FloatRect viewBounds(mainView.getCenter() - mainView.getSize() / 2.f, mainView.getSize());
+                    // static layers at the window's resolution, not the logical one, so they're as sharp as the tiles were
+                    tileBatches.setLayerScale(std::min(static_cast<float>(window.getSize().x) / mainView.getSize().x,
+                                                       static_cast<float>(window.getSize().y) / mainView.getSize().y));
+                    tileBatches.applyChanges(tileChanges);
+                    tileChanges.clear();
+                    tileBatches.update(viewBounds);
+                    window.draw(tileBatches);
                 }
                 window.draw(playerShape);
 
@@ -1428,16 +1708,9 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                                              " Vel: " + std::to_string(static_cast<int>(playerBody.getVelocity().x)) + "," + std::to_string(static_cast<int>(playerBody.getVelocity().y)) +
                                              " Ground: " + (playerBody.isOnGround() ? "Y" : "N");
 
-                    const phys::PlatformBody* groundPlat = playerBody.getGroundPlatform();
-                    if (groundPlat) {
-                        bool platformStillExistsAndMatches = false;
-                        for (const auto& body_ref : bodies) {
-                            if (&body_ref == groundPlat) {
-                                platformStillExistsAndMatches = true;
-                                break;
-                            }
-                        }
-                        if (platformStillExistsAndMatches) {
+                    if (playerBody.getGroundPlatform()) {
+                        const phys::PlatformBody* groundPlat = collisionWorld.get(playerBody.getGroundPlatform());
+                        if (groundPlat) {
                             debugString += " (ID:" + std::to_string(groundPlat->getID()) +
                                            (groundPlat->getType() == phys::bodyType::none ? " TYPE_NONE" : (" Type:" + std::to_string(static_cast<int>(groundPlat->getType())))) + ")";
                             if (groundPlat->getType() == phys::bodyType::portal) {
@@ -1447,26 +1720,52 @@ if (menuMusic.getStatus() != sf::Music::Status::Playing && menuMusic.openFromFil
                             debugString += " (GroundRef: INVALID)";
                         }
                     }
+                    // what the narrowphase pulled through the cache last tick, packed arrays vs walking PlatformBody
+                    debugString += "\nNarrow: " + std::to_string(lastNarrowphaseTests) +
+                                   " bytes: " + std::to_string(lastNarrowphaseTests * phys::CollisionWorld::HOT_BYTES_PER_BODY) +
+                                   " (vector: " + std::to_string(lastNarrowphaseTests * sizeof(phys::PlatformBody)) + ")" +
+                                   " Resting: " + std::to_string(restingFastTicks) + "/" + std::to_string(restingFastTicks + fullSolveTicks) + " ticks" +
+                                   "\nRespawn: " + (lastRespawnMicroseconds < 0 ? std::string("-") : std::to_string(lastRespawnMicroseconds) + " us");
+                    const TextureCache::Stats textureStats = levelManager.getTextureCache().getStats();
+                    debugString += "\nTextures: " + std::to_string(textureStats.entries) + " (" + std::to_string(textureStats.bytes / (1024 * 1024)) + "/" +
+                                   std::to_string(levelManager.getTextureCache().getByteBudget() / (1024 * 1024)) + " MB) hit " +
+                                   std::to_string(textureStats.hits) + " miss " + std::to_string(textureStats.misses) + " evict " + std::to_string(textureStats.evictions);
+                    if (currentLevelData.atlas) {
+                        const TextureAtlas::Stats& atlasStats = currentLevelData.atlas->getStats();
+                        debugString += "\nAtlas: " + std::to_string(atlasStats.packed) + " in " + std::to_string(atlasStats.pages) + " page(s) " +
+                                       std::to_string(static_cast<int>(atlasStats.occupancy() * 100.f)) + "% packed in " + std::to_string(atlasStats.packMs) + " ms";
+                    }
+                    const TileBatchRenderer::Stats& batchStats = tileBatches.getStats();
+                    debugString += "\nTiles: " + std::to_string(batchStats.drawnTiles) + " drawn " + std::to_string(batchStats.culledTiles) +
+                                   " culled of " + std::to_string(batchStats.tiles) + " (" + std::to_string(batchStats.dynamicTiles) + " dynamic) in " +
+                                   std::to_string(batchStats.drawCalls) + " draws, " + std::to_string(batchStats.vertices) + " verts, " +
+                                   std::to_string(batchStats.rebakes) + " rebakes" +
+                                   "\nLayers: " + std::to_string(batchStats.layers) + " (" + std::to_string(batchStats.layerBytes / (1024 * 1024)) + " MB) " +
+                                   std::to_string(batchStats.layerRenders) + " renders" +
+                                   "\nChanges: " + std::to_string(tileChanges.getLastTickChanges()) + " last tick, " +
+                                   std::to_string(batchStats.tileChanges) + " tiles " + std::to_string(batchStats.quadWrites) + " quads applied";
+                    const sprites::SpriteManager::AnimationStats animationStats = spriteManager.getAnimationStats();
+                    debugString += "\nAnims: " + std::to_string(animationStats.playing) + " playing of " + std::to_string(animationStats.animations) +
+                                   " (" + std::to_string(animationStats.bound) + " on tiles) " + std::to_string(animationStats.frameChanges) + " frame changes";
+                    const AssetRegistry::Stats assetStats = assets.getStats();
+                    debugString += "\nAssets: " + std::to_string(assetStats.loadsLastFrame) + " loads last frame, " + std::to_string(assetStats.totalLoads) +
+                                   " total (" + std::to_string(assetStats.failedLoads) + " failed) " + std::to_string(assetStats.textures) + " tex " +
+                                   std::to_string(assetStats.fonts) + " fonts " + std::to_string(assetStats.soundBuffers) + " sounds";
+                    if (levelManager.getStreamer().isStreaming()) {
+                        const LevelStreamer::Stats streamStats = levelManager.getStreamer().getStats();
+                        debugString += "\nChunks: " + std::to_string(streamStats.resident) + "/" + std::to_string(streamStats.chunks) +
+                                       " resident, " + std::to_string(streamStats.loading) + " loading, in " + std::to_string(streamStats.activations) +
+                                       " out " + std::to_string(streamStats.evictions) + ", bodies " + std::to_string(platformTree.getProxyCount());
+                    }
                     debugText.setString(debugString);
                 }
                 window.draw(debugText);
 
                 if (goalReached && doorAnimationOngoing){
-                    if (animClock.getElapsedTime() >= frameTime_door){
-                        animClock.restart();
-                        std::cout << "ANIMATED DOOR! Frame "<< doorCurrentFrame 
-                        << " [" << doorAnimFramesTopLeft[doorCurrentFrame].x << ","
-                        << doorAnimFramesTopLeft[doorCurrentFrame].y << "]" << std::endl;
-                        animatedDoorTile->setTextureRect(sf::IntRect({ doorAnimFramesTopLeft[doorCurrentFrame].x,
-                                                                    doorAnimFramesTopLeft[doorCurrentFrame].y},
-                                                                    {doorWidth, doorHeight}));
-                        doorCurrentFrame++;
-                    }
-                    window.draw(*animatedDoorTile);
-                    if (doorCurrentFrame == 5){
+                    if (spriteManager.isAnimationFinished(doorAnimation)){
                         goalReached = false;
                         doorAnimationOngoing = false;
-                        doorCurrentFrame = 0;
+                        doorAnimation = sprites::SpriteManager::NoAnimation;
                         if (levelManager.hasNextLevel()) {
                             if (levelManager.requestLoadNextLevel(currentLevelData)) {
                                 currentState = GameState::TRANSITIONING;
@@ -0,0 +1,146 @@
+// sweptAABBBatch against the scalar sweptAABB, for every sweep kernel this cpu can run
+// hit masks have to agree box for box, and every event has to be the same bits (time, axis, platform)
+// exits non-zero on the first mismatch, which ctest reports as a failure
+#include "CollisionSystem.hpp"
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Case {
+        std::string name;
+        sf::FloatRect body;
+        sf::Vector2f displacement;
+        std::vector<phys::PlatformBody> platforms;
+    };
+
+    phys::PlatformBody box(float x, float y, float width, float height) {
+        return phys::PlatformBody(0, {x, y}, width, height, phys::bodyType::solid);
+    }
+
+    std::uint32_t bitsOf(float value) {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    // random boxes scattered around a random body, counts chosen so every kernel also gets a scalar tail
+    Case randomCase(std::mt19937& rng, std::size_t index) {
+        std::uniform_real_distribution<float> coordinate(-600.f, 600.f);
+        std::uniform_real_distribution<float> extent(1.f, 200.f);
+        std::uniform_real_distribution<float> velocity(-900.f, 900.f);
+        std::uniform_int_distribution<int> count(1, 67);
+        std::uniform_int_distribution<int> axisMode(0, 5);
+
+        Case c;
+        c.name = "random " + std::to_string(index);
+        c.body = sf::FloatRect({coordinate(rng), coordinate(rng)}, {extent(rng), extent(rng)});
+        c.displacement = {velocity(rng), velocity(rng)};
+        // some sweeps along one axis only, the static axis takes a different path in both versions
+        const int mode = axisMode(rng);
+        if (mode == 0) c.displacement.x = 0.f;
+        if (mode == 1) c.displacement.y = 0.f;
+        const int platforms = count(rng);
+        for (int i = 0; i < platforms; ++i) c.platforms.push_back(box(coordinate(rng), coordinate(rng), extent(rng), extent(rng)));
+        return c;
+    }
+
+    std::vector<Case> edgeCases() {
+        std::vector<Case> cases;
+        const sf::FloatRect body({0.f, 0.f}, {32.f, 32.f});
+
+        // boxes that touch the body on each side, overlap it, contain it, or sit just out of reach
+        auto ring = []() {
+            return std::vector<phys::PlatformBody>{
+                box(32.f, 0.f, 32.f, 32.f), box(-32.f, 0.f, 32.f, 32.f), box(0.f, 32.f, 32.f, 32.f), box(0.f, -32.f, 32.f, 32.f),
+                box(32.f, 32.f, 32.f, 32.f), box(-32.f, -32.f, 32.f, 32.f), box(16.f, 16.f, 32.f, 32.f), box(-64.f, -64.f, 160.f, 160.f),
+                box(64.f, 0.f, 32.f, 32.f), box(0.f, 64.f, 32.f, 32.f), box(32.f, 0.f, 0.f, 32.f), box(0.f, 32.f, 32.f, 0.f),
+                box(100.f, 100.f, 1.f, 1.f), box(31.999f, 0.f, 8.f, 32.f), box(0.f, 32.001f, 32.f, 8.f), box(-8.f, 31.f, 48.f, 1.f),
+                box(33.f, -100.f, 4.f, 232.f)
+            };
+        };
+
+        cases.push_back({"zero displacement", body, {0.f, 0.f}, ring()});
+        cases.push_back({"below threshold", body, {5e-6f, -5e-6f}, ring()});
+        cases.push_back({"at threshold", body, {1e-5f, 1e-5f}, ring()});
+        cases.push_back({"just over threshold", body, {2e-5f, 0.f}, ring()});
+        cases.push_back({"right, reaches the touching box exactly", body, {32.f, 0.f}, ring()});
+        cases.push_back({"left", body, {-32.f, 0.f}, ring()});
+        cases.push_back({"down", body, {0.f, 32.f}, ring()});
+        cases.push_back({"up", body, {0.f, -32.f}, ring()});
+        cases.push_back({"diagonal corner", body, {32.f, 32.f}, ring()});
+        cases.push_back({"diagonal back", body, {-32.f, -32.f}, ring()});
+        cases.push_back({"sliding along the touching edges", body, {0.f, 48.f}, ring()});
+        cases.push_back({"tiny step", body, {0.01f, 0.01f}, ring()});
+        cases.push_back({"huge step", body, {1e6f, -1e6f}, ring()});
+
+        // large but finite, no lane may turn into a nan
+        std::vector<phys::PlatformBody> far;
+        for (int i = 0; i < 37; ++i) {
+            const float offset = static_cast<float>(i - 18) * 1e7f;
+            far.push_back(box(offset, -offset, 1e6f, 1e6f));
+            far.push_back(box(1e20f, offset, 1e19f, 1e19f));
+        }
+        cases.push_back({"far boxes, small step", sf::FloatRect({1e7f, -1e7f}, {64.f, 64.f}), {3e-5f, -3e-5f}, far});
+        cases.push_back({"far boxes, huge step", sf::FloatRect({-1e8f, 1e8f}, {1e5f, 1e5f}), {1e9f, -1e9f}, far});
+        cases.push_back({"far boxes, extreme coordinates", sf::FloatRect({1e20f, 1e20f}, {1e18f, 1e18f}), {-1e19f, 0.f}, far});
+        return cases;
+    }
+
+    // one case under the active kernel, returns false on the first difference
+    bool runCase(const Case& c, const std::string& kernel) {
+        phys::CollisionWorld world;
+        world.rebuild(c.platforms);
+        const std::size_t count = world.size();
+
+        std::vector<std::uint8_t> hits(count, 0xFF);
+        phys::CollisionSystem::sweptAABBBatch(c.body, c.displacement,
+                                             world.minXData(), world.minYData(), world.maxXData(), world.maxYData(),
+                                             count, hits.data());
+
+        const phys::DynamicBody body(c.body.position, c.body.size.x, c.body.size.y);
+        std::vector<std::size_t> indices(count);
+        for (std::size_t i = 0; i < count; ++i) indices[i] = i;
+        std::vector<phys::CollisionEvent> events(count);
+        phys::CollisionSystem::sweptAABBBatch(body, c.displacement, world, indices.data(), count, events.data());
+
+        for (std::size_t i = 0; i < count; ++i) {
+            phys::CollisionEvent expected;
+            const bool expectedHit = phys::CollisionSystem::sweptAABB(body, c.displacement, world, i, 1.0f, expected);
+            const phys::CollisionEvent& got = events[i];
+            const bool sameEvent = bitsOf(got.time) == bitsOf(expected.time) && got.axis == expected.axis &&
+                                   got.hitPlatform == expected.hitPlatform;
+            if (hits[i] != (expectedHit ? 1 : 0) || !sameEvent) {
+                std::cerr << "[" << kernel << "] " << c.name << ", box " << i
+                          << ": hit " << int(hits[i]) << " vs " << expectedHit
+                          << ", time " << got.time << " vs " << expected.time
+                          << ", axis " << got.axis << " vs " << expected.axis << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    const std::vector<Case> edges = edgeCases();
+    const std::size_t RANDOM_CASES = 5000;
+
+    for (const char* kernel : phys::CollisionSystem::supportedSweepKernels()) {
+        if (!phys::CollisionSystem::forceSweepKernel(kernel)) {
+            std::cerr << "could not select " << kernel << std::endl;
+            return 1;
+        }
+        for (const Case& c : edges) {
+            if (!runCase(c, kernel)) return 1;
+        }
+        std::mt19937 rng(20240611u); // same inputs for every kernel
+        for (std::size_t i = 0; i < RANDOM_CASES; ++i) {
+            if (!runCase(randomCase(rng, i), kernel)) return 1;
+        }
+        std::cout << kernel << ": " << edges.size() << " edge cases and " << RANDOM_CASES << " random sweeps match" << std::endl;
+    }
+    return 0;
+}
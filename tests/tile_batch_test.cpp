@@ -0,0 +1,196 @@
+// TileBatchRenderer over a synthetic tile set, checks the draw call, vertex and culling stats it reports
+// layers stay off: they need a render texture, this runs without a window or gl context
+// every failed check is printed, the exit code is non-zero if there was any (ctest reports that as a failure)
+#include "TileBatchRenderer.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void expect(const std::string& what, std::size_t got, std::size_t expected) {
+        if (got == expected) return;
+        std::cerr << what << ": got " << got << ", expected " << expected << std::endl;
+        ++failures;
+    }
+
+    const float TILE = 32.f;
+    const float CELL = 512.f;                          // 16 x 16 tiles per cell
+    const int GRID = 64;                               // 64 x 64 tiles = 4 x 4 cells
+
+    // checkerboard of two textures, so every cell holds two static batches
+    std::vector<Tile> makeGrid(const sf::Texture& a, const sf::Texture& b) {
+        std::vector<Tile> tiles;
+        tiles.reserve(GRID * GRID + 4);
+        for (int y = 0; y < GRID; ++y) {
+            for (int x = 0; x < GRID; ++x) {
+                Tile tile({TILE, TILE});
+                tile.setPosition({x * TILE, y * TILE});
+                tile.setTexture((x + y) % 2 ? &a : &b);
+                tiles.push_back(tile);
+            }
+        }
+        return tiles;
+    }
+}
+
+int main() {
+    sf::Texture textureA, textureB, textureC;
+    std::vector<Tile> tiles = makeGrid(textureA, textureB);
+    const std::size_t staticCount = tiles.size();
+
+    // four dynamic tiles sharing one texture, two near the origin, two at the far corner of the level
+    const sf::Vector2f dynamicAt[] = {{40.f, 40.f}, {100.f, 60.f}, {1900.f, 1900.f}, {2000.f, 1950.f}};
+    std::vector<std::size_t> dynamic;
+    for (const sf::Vector2f& position : dynamicAt) {
+        Tile tile({TILE, TILE});
+        tile.setPosition(position);
+        tile.setTexture(&textureC);
+        dynamic.push_back(tiles.size());
+        tiles.push_back(tile);
+    }
+
+    TileBatchRenderer renderer(CELL);
+    renderer.setLayersEnabled(false);
+    renderer.build(tiles, dynamic);
+    const TileBatchRenderer::Stats& stats = renderer.getStats();
+    expect("tiles", stats.tiles, tiles.size());
+    expect("dynamic tiles", stats.dynamicTiles, 4);
+    expect("static batches", stats.batches, 16 * 2);
+
+    // whole level in view: two batches per cell, both dynamic cells, nothing culled
+    renderer.update(sf::FloatRect({-100.f, -100.f}, {GRID * TILE + 200.f, GRID * TILE + 200.f}));
+    expect("full view draw calls", stats.drawCalls, 16 * 2 + 2);
+    expect("full view vertices", stats.vertices, tiles.size() * 6);
+    expect("full view drawn", stats.drawnTiles, tiles.size());
+    expect("full view culled", stats.culledTiles, 0);
+
+    // one cell's worth of view in the top left: that cell's two batches and the near dynamic pair only.
+    // the far pair shares the texture but sits in another cell, so it's culled
+    const sf::FloatRect corner({0.f, 0.f}, {CELL - 1.f, CELL - 1.f});
+    renderer.update(corner);
+    expect("corner draw calls", stats.drawCalls, 2 + 1);
+    expect("corner vertices", stats.vertices, (16 * 16 + 2) * 6);
+    expect("corner drawn", stats.drawnTiles, 16 * 16 + 2);
+    expect("corner culled", stats.culledTiles, tiles.size() - (16 * 16 + 2));
+
+    // view past the level: nothing drawn, everything culled
+    renderer.update(sf::FloatRect({10000.f, 10000.f}, {800.f, 600.f}));
+    expect("empty view draw calls", stats.drawCalls, 0);
+    expect("empty view vertices", stats.vertices, 0);
+    expect("empty view culled", stats.culledTiles, tiles.size());
+
+    // a near dynamic tile moves to the far corner and the other one vanishes: only the change list gets written
+    TileChangeList changes;
+    changes.reset(tiles.size());
+    tiles[dynamic[0]].setPosition({1950.f, 1990.f});
+    changes.mark(dynamic[0], TileChangeList::Position);
+    tiles[dynamic[1]].setFillColor(sf::Color::Transparent);
+    changes.mark(dynamic[1], TileChangeList::Color);
+    renderer.applyChanges(changes);
+    changes.clear();
+    expect("quad writes", stats.quadWrites, 2);
+
+    renderer.update(corner);
+    expect("corner after move draw calls", stats.drawCalls, 2);
+    expect("corner after move vertices", stats.vertices, 16 * 16 * 6);
+    expect("corner after move culled", stats.culledTiles, staticCount - 16 * 16 + 3);
+
+    // culling is per cell, the far cell comes in whole along with all three dynamic tiles now in it
+    const sf::FloatRect farCorner({1800.f, 1800.f}, {400.f, 400.f});
+    renderer.update(farCorner);
+    expect("far corner draw calls", stats.drawCalls, 2 + 1);
+    expect("far corner drawn", stats.drawnTiles, 16 * 16 + 3);
+    expect("far corner vertices", stats.vertices, (16 * 16 + 3) * 6);
+
+    // fading back in gets the tile a quad again, no static cell gets rebaked for it
+    const std::size_t rebakes = stats.rebakes;
+    tiles[dynamic[1]].setFillColor(sf::Color::White);
+    changes.mark(dynamic[1], TileChangeList::Color);
+    renderer.applyChanges(changes);
+    changes.clear();
+    renderer.update(corner);
+    expect("corner after fade in drawn", stats.drawnTiles, 16 * 16 + 1);
+    expect("rebakes for dynamic changes", stats.rebakes, rebakes);
+
+    // a static tile changing colour rebakes its own cell and nothing else
+    tiles[0].setFillColor(sf::Color::Red);
+    changes.mark(0, TileChangeList::Color);
+    renderer.applyChanges(changes);
+    changes.clear();
+    renderer.update(corner);
+    expect("rebakes for one static change", stats.rebakes, rebakes + 1);
+
+    // a hot reload swaps in a bigger static tile somewhere else: it leaves the corner cell and hangs out of cell (1, 3)
+    // far enough to reach a view that only touches cell (3, 3). both cells it touched get rebaked
+    Tile reloaded({600.f, 40.f});
+    reloaded.setPosition({1000.f, 1700.f});
+    reloaded.setTexture(&textureA);
+    tiles[1] = reloaded;
+    changes.mark(1, TileChangeList::All);
+    renderer.applyChanges(changes);
+    changes.clear();
+    renderer.update(corner);
+    expect("corner after reload drawn", stats.drawnTiles, 16 * 16 - 1 + 1);
+    expect("rebakes for a moved static tile", stats.rebakes, rebakes + 3);
+    renderer.update(sf::FloatRect({1560.f, 1700.f}, {20.f, 10.f}));
+    expect("reloaded tile's view drawn", stats.drawnTiles, (16 * 16 + 1) + 16 * 16 + 3);
+
+    // a streamed chunk comes in past the right edge of the level, a cell of static tiles and one dynamic tile.
+    // only its own cell gets baked, the level around it stays as it was
+    const sf::FloatRect fullView({-100.f, -100.f}, {GRID * TILE + 200.f, GRID * TILE + 200.f});
+    renderer.update(fullView);
+    const std::size_t levelDrawn = stats.drawnTiles;
+    const std::size_t levelTiles = stats.tiles;
+    const float chunkX = GRID * TILE + CELL;
+    const std::size_t chunkFirst = tiles.size();
+    for (int y = 0; y < 16; ++y) {
+        for (int x = 0; x < 16; ++x) {
+            Tile tile({TILE, TILE});
+            tile.setPosition({chunkX + x * TILE, y * TILE});
+            tile.setTexture(&textureA);
+            tiles.push_back(tile);
+        }
+    }
+    Tile mover({TILE, TILE});
+    mover.setPosition({chunkX + 8.f, 8.f});
+    mover.setTexture(&textureC);
+    const std::vector<std::size_t> chunkDynamic{tiles.size()};
+    tiles.push_back(mover);
+    const std::size_t chunkCount = tiles.size() - chunkFirst;
+
+    const std::size_t rebakesBeforeChunk = stats.rebakes;
+    renderer.addTiles(chunkFirst, chunkCount, chunkDynamic);
+    const sf::FloatRect chunkView({chunkX, 0.f}, {CELL - 1.f, CELL - 1.f});
+    renderer.update(chunkView);
+    expect("chunk tiles", stats.tiles, levelTiles + chunkCount);
+    expect("chunk dynamic tiles", stats.dynamicTiles, 5);
+    expect("chunk rebakes", stats.rebakes, rebakesBeforeChunk + 1);
+    expect("chunk draw calls", stats.drawCalls, 1 + 1);
+    expect("chunk drawn", stats.drawnTiles, 16 * 16 + 1);
+
+    // and it goes again: its cell is rebaked empty and the dynamic slot is given back
+    renderer.removeTiles(chunkFirst, chunkCount);
+    renderer.update(chunkView);
+    expect("evicted chunk tiles", stats.tiles, levelTiles);
+    expect("evicted chunk dynamic tiles", stats.dynamicTiles, 4);
+    expect("evicted chunk rebakes", stats.rebakes, rebakesBeforeChunk + 2);
+    expect("evicted chunk draw calls", stats.drawCalls, 0);
+    expect("evicted chunk drawn", stats.drawnTiles, 0);
+    renderer.update(fullView);
+    expect("level after eviction drawn", stats.drawnTiles, levelDrawn);
+
+    // the same slots coming back in reuse what the eviction left
+    renderer.addTiles(chunkFirst, chunkCount, chunkDynamic);
+    renderer.update(chunkView);
+    expect("chunk again drawn", stats.drawnTiles, 16 * 16 + 1);
+    expect("chunk again batches", stats.batches, 16 * 2 + 1);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "tile batch stats match" << std::endl;
+    return 0;
+}